@@ -26,18 +26,36 @@
 //----------------------------------------------------------------------------------------
 
 # pragma once
+# include <cstddef>
 # include <cstdint>
+# include <cmath>
+# include <cstring>
 # include <algorithm>
 # include <array>
+# include <atomic>
+# include <condition_variable>
+# include <future>
 # include <iterator>
+# include <limits>
+# include <list>
+# include <memory>
+# include <mutex>
 # include <numeric>
+# include <queue>
 # include <random>
+# include <thread>
 # include <type_traits>
+# include <unordered_map>
+# include <vector>
 
 # if __has_include(<concepts>) && defined(__cpp_concepts)
 #	include <concepts>
 # endif
 
+# if __has_include(<bit>) && (201703L < __cplusplus)
+#	include <bit>
+# endif
+
 
 // Library major version
 # define SIVPERLIN_VERSION_MAJOR			3
@@ -60,10 +78,18 @@
 # endif
 
 
-// std::uniform_random_bit_generator concept
+// constexpr for functions that need C++20 (std::is_constant_evaluated(), uninitialized local variables)
+# if __cpp_lib_is_constant_evaluated && (201907L <= __cpp_constexpr)
+#	define SIVPERLIN_CONSTEXPR_CXX20 constexpr
+# else
+#	define SIVPERLIN_CONSTEXPR_CXX20
+# endif
+
+
+// std::uniform_random_bit_generator concept (URBG is deduced as a reference for lvalue generators)
 # if __cpp_lib_concepts
-#	define SIVPERLIN_CONCEPT_URBG  template <std::uniform_random_bit_generator URBG>
-#	define SIVPERLIN_CONCEPT_URBG_ template <std::uniform_random_bit_generator URBG>
+#	define SIVPERLIN_CONCEPT_URBG  template <class URBG> requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
+#	define SIVPERLIN_CONCEPT_URBG_ template <class URBG> requires std::uniform_random_bit_generator<std::remove_cvref_t<URBG>>
 # else
 #	define SIVPERLIN_CONCEPT_URBG  template <class URBG, std::enable_if_t<std::conjunction_v<std::is_invocable<URBG&>, std::is_unsigned<std::invoke_result_t<URBG&>>>>* = nullptr>
 #	define SIVPERLIN_CONCEPT_URBG_ template <class URBG, std::enable_if_t<std::conjunction_v<std::is_invocable<URBG&>, std::is_unsigned<std::invoke_result_t<URBG&>>>>*>
@@ -81,579 +107,5943 @@
 # endif
 
 
+// SIMD register width in bytes used by the batch functions
+# ifndef SIVPERLIN_SIMD_BYTES
+#	if defined(__AVX512F__)
+#		define SIVPERLIN_SIMD_BYTES 64
+#	elif defined(__AVX__)
+#		define SIVPERLIN_SIMD_BYTES 32
+#	else
+#		define SIVPERLIN_SIMD_BYTES 16
+#	endif
+# endif
+
+// Approximate size in bytes of the tiles processed by ParallelFill()
+# ifndef SIVPERLIN_TILE_BYTES
+#	define SIVPERLIN_TILE_BYTES (256 * 1024)
+# endif
+
+// Batch functions evaluate an octave cell by cell when at least this many samples of a row fall into each lattice cell
+# ifndef SIVPERLIN_CELL_RUN_SAMPLES
+#	define SIVPERLIN_CELL_RUN_SAMPLES 8
+# endif
+
+
+// 1: counts the calls, samples and octave counts of the noise functions (see GetNoiseInstrumentation())
+# ifndef SIVPERLIN_ENABLE_INSTRUMENTATION
+#	define SIVPERLIN_ENABLE_INSTRUMENTATION 0
+# endif
+
+// With SIVPERLIN_ENABLE_INSTRUMENTATION, times one in this many calls on each thread (0: no timing)
+# ifndef SIVPERLIN_INSTRUMENTATION_TIMING_INTERVAL
+#	define SIVPERLIN_INSTRUMENTATION_TIMING_INTERVAL 0
+# endif
+
+// 1: the batch octave fills select AVX2 or AVX-512F code at run time on x86 with GCC and Clang (see GetNoiseSimdLevel())
+# ifndef SIVPERLIN_RUNTIME_DISPATCH
+#	define SIVPERLIN_RUNTIME_DISPATCH 0
+# endif
+
+# if SIVPERLIN_RUNTIME_DISPATCH && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#	define SIVPERLIN_HAS_RUNTIME_DISPATCH 1
+#	include <cstdlib>
+#	include <string_view>
+# else
+#	define SIVPERLIN_HAS_RUNTIME_DISPATCH 0
+# endif
+
+# if SIVPERLIN_ENABLE_INSTRUMENTATION
+#	include <chrono>
+#	if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#		include <intrin.h>
+#	elif defined(__x86_64__) || defined(__i386__)
+#		include <x86intrin.h>
+#	endif
+#	define SIVPERLIN_INSTRUMENT(...) const perlin_detail::InstrumentationScope sivperlinInstrumentationScope{ __VA_ARGS__ }
+# else
+#	define SIVPERLIN_INSTRUMENT(...)
+# endif
+
+// constexpr for functions that are constexpr in C++17 unless their hook needs SIVPERLIN_CONSTEXPR_CXX20 (reseedFast())
+# if SIVPERLIN_ENABLE_INSTRUMENTATION
+#	define SIVPERLIN_CONSTEXPR_INSTRUMENTED SIVPERLIN_CONSTEXPR_CXX20
+# else
+#	define SIVPERLIN_CONSTEXPR_INSTRUMENTED constexpr
+# endif
+
+// Clang cannot turn off FMA contraction for a single function, so with runtime dispatch it is turned off for the whole library (see FillOctaveAVX512())
+# if SIVPERLIN_HAS_RUNTIME_DISPATCH && defined(__clang__)
+#	pragma float_control(push)
+#	pragma clang fp contract(off)
+# endif
+
+
 namespace siv
 {
+	///////////////////////////////////////
+	//
+	//	Regular sampling grid for the batch functions
+	//
+	//	Sample (i, j, k) is taken at (x + (offsetX + i) * stepX, y + (offsetY + j) * stepY, z + (offsetZ + k) * stepZ)
+	//	and stored at dst[(k * height + j) * width + i].
+	//	2D functions ignore z, stepZ, depth and offsetZ.
+	//
+	//	The offsets allow a grid to be split into tiles that sample exactly the same positions as the whole grid.
+	//	They may be negative.
+	//
 	template <class Float>
-	class BasicPerlinNoise
+	struct BasicNoiseGrid
 	{
-	public:
+		Float x = 0, y = 0, z = 0;
 
-		static_assert(std::is_floating_point_v<Float>);
+		Float stepX = 1, stepY = 1, stepZ = 1;
 
-		///////////////////////////////////////
-		//
-		//	Typedefs
-		//
+		std::size_t width = 0, height = 0, depth = 1;
 
-		using state_type = std::array<std::uint8_t, 256>;
+		std::int64_t offsetX = 0, offsetY = 0, offsetZ = 0;
+	};
 
-		using value_type = Float;
+	// Number of octaves of level `level` of fillOctave2DPyramid(): the octaves whose wavelength is at least two samples
+	// of that level (step * 2^level), but at least 1 and at most `octaves`. Higher octaves would only alias.
+	template <class Float>
+	[[nodiscard]]
+	constexpr std::int32_t NoisePyramidOctaves(const BasicNoiseGrid<Float>& grid, std::size_t level, std::int32_t octaves) noexcept;
 
-		using default_random_engine = std::mt19937;
+	///////////////////////////////////////
+	//
+	//	Parameters of domain warping
+	//
+	//	Each warp level displaces the position by strength * (octave noise of each axis),
+	//	evaluated with octaves and persistence at the position plus a fixed offset per axis.
+	//	depth levels are applied in turn before the base octave noise is evaluated at the warped position.
+	//
+	template <class Float>
+	struct BasicNoiseWarp
+	{
+		std::int32_t depth = 1;
 
-		using seed_type = typename default_random_engine::result_type;
+		Float strength = 1;
 
-		///////////////////////////////////////
-		//
-		//	Constructors
-		//
+		std::int32_t octaves = 4;
 
-		SIVPERLIN_NODISCARD_CXX20
-		constexpr BasicPerlinNoise() noexcept;
+		Float persistence = Float(0.5);
+	};
 
-		SIVPERLIN_NODISCARD_CXX20
-		explicit BasicPerlinNoise(seed_type seed);
+	///////////////////////////////////////
+	//
+	//	Noise value and its gradient
+	//
+	template <class Float>
+	struct BasicNoiseDerivative2D
+	{
+		Float value = 0;
 
-		SIVPERLIN_CONCEPT_URBG
-		SIVPERLIN_NODISCARD_CXX20
-		explicit BasicPerlinNoise(URBG&& urbg);
+		Float dx = 0, dy = 0;
+	};
 
-		///////////////////////////////////////
-		//
-		//	Reseed
-		//
+	template <class Float>
+	struct BasicNoiseDerivative3D
+	{
+		Float value = 0;
 
-		void reseed(seed_type seed);
+		Float dx = 0, dy = 0, dz = 0;
+	};
 
-		SIVPERLIN_CONCEPT_URBG
-		void reseed(URBG&& urbg);
+	///////////////////////////////////////
+	//
+	//	Noise kernel used by BasicPerlinNoise
+	//
+	enum class NoiseKernel : std::uint8_t
+	{
+		// noise1D() and noise2D() sample noise3D() at y = SIVPERLIN_DEFAULT_Y and z = SIVPERLIN_DEFAULT_Z.
+		// Produces the same output as v3.0.
+		Compatible,
 
-		///////////////////////////////////////
-		//
-		//	Serialization
-		//
+		// noise1D() and noise2D() use dedicated kernels that only evaluate 2 and 4 lattice corners.
+		Dedicated,
 
-		[[nodiscard]]
-		constexpr const state_type& serialize() const noexcept;
+		// Simplex-style gradient noise that evaluates 2, 3 and 4 lattice points in 1D, 2D and 3D (see perlin_detail::SimplexBlock3D()).
+		// Uses the same permutation table, seeding and state as the other kernels. Periodic noise is not available.
+		Simplex,
+	};
 
-		constexpr void deserialize(const state_type& state) noexcept;
+	///////////////////////////////////////
+	//
+	//	Layout of the results of BasicNoiseBank batch functions
+	//
+	enum class NoiseBankLayout : std::uint8_t
+	{
+		// dst[index * K + k]
+		Interleaved,
 
-		///////////////////////////////////////
-		//
-		//	Noise (The result is in the range [-1, 1])
-		//
+		// dst[k * (width * height * depth) + index]
+		Planar,
+	};
 
-		[[nodiscard]]
-		value_type noise1D(value_type x) const noexcept;
+	///////////////////////////////////////
+	//
+	//	Instrumentation
+	//
+	//	With SIVPERLIN_ENABLE_INSTRUMENTATION defined as 1, each call of the BasicPerlinNoise functions below is counted
+	//	with the number of samples it evaluates (1, or the size of the grid), and the octave functions add their octave count to a histogram.
+	//	Calls made by another counted function (octave2D() from octave2D_01(), noise3D() from the NoiseKernel::Compatible noise1D(), ...) are not counted again.
+	//	With SIVPERLIN_INSTRUMENTATION_TIMING_INTERVAL = n, one in n calls on each thread is also timed, in TSC cycles on x86 and in nanoseconds elsewhere.
+	//	Counters are kept per thread and only summed by GetNoiseInstrumentation(). Compile-time evaluation is not counted.
+	//	Without SIVPERLIN_ENABLE_INSTRUMENTATION, nothing is counted and GetNoiseInstrumentation() returns zeros.
+	//
+	enum class NoiseEntryPoint : std::uint8_t
+	{
+		Noise1D, Noise2D, Noise3D,
+		Noise1D_01, Noise2D_01, Noise3D_01,
+		Octave1D, Octave2D, Octave3D,
+		Octave1D_11, Octave2D_11, Octave3D_11,
+		Octave1D_01, Octave2D_01, Octave3D_01,
+		NormalizedOctave1D, NormalizedOctave2D, NormalizedOctave3D,
+		NormalizedOctave1D_01, NormalizedOctave2D_01, NormalizedOctave3D_01,
+		FillNoise2D, FillNoise3D,
+		FillNoise2D_01, FillNoise3D_01,
+		FillOctave2D, FillOctave3D,
+		FillOctave2D_11, FillOctave3D_11,
+		FillOctave2D_01, FillOctave3D_01,
+		FillNormalizedOctave2D, FillNormalizedOctave3D,
+		FillNormalizedOctave2D_01, FillNormalizedOctave3D_01,
+		Reseed, ReseedFast,
+	};
 
-		[[nodiscard]]
-		value_type noise2D(value_type x, value_type y) const noexcept;
+	inline constexpr std::size_t NoiseEntryPointCount = (static_cast<std::size_t>(NoiseEntryPoint::ReseedFast) + 1);
 
-		[[nodiscard]]
-		value_type noise3D(value_type x, value_type y, value_type z) const noexcept;
+	// Octave counts of 0 to 31, and 32 or more. Negative counts are counted as 0.
+	inline constexpr std::size_t NoiseOctaveHistogramSize = 33;
 
-		///////////////////////////////////////
-		//
-		//	Noise (The result is remapped to the range [0, 1])
-		//
+	// Name of the function, such as "octave2D_01"
+	[[nodiscard]]
+	constexpr const char* NoiseEntryPointName(NoiseEntryPoint entryPoint) noexcept;
 
-		[[nodiscard]]
-		value_type noise1D_01(value_type x) const noexcept;
+	struct NoiseEntryPointStats
+	{
+		std::uint64_t calls = 0;
 
-		[[nodiscard]]
-		value_type noise2D_01(value_type x, value_type y) const noexcept;
+		std::uint64_t samples = 0;
 
-		[[nodiscard]]
-		value_type noise3D_01(value_type x, value_type y, value_type z) const noexcept;
+		// Calls that were timed, their samples, and the ticks they took
+		std::uint64_t timedCalls = 0;
 
-		///////////////////////////////////////
-		//
-		//	Octave noise (The result can be out of the range [-1, 1])
-		//
+		std::uint64_t timedSamples = 0;
 
-		[[nodiscard]]
-		value_type octave1D(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+		std::uint64_t ticks = 0;
+	};
 
-		[[nodiscard]]
-		value_type octave2D(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+	struct NoiseInstrumentation
+	{
+		// Indexed by NoiseEntryPoint
+		std::array<NoiseEntryPointStats, NoiseEntryPointCount> entryPoints{};
+
+		// Calls of the octave functions by octave count
+		std::array<std::uint64_t, NoiseOctaveHistogramSize> octaves{};
 
 		[[nodiscard]]
-		value_type octave3D(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+		constexpr const NoiseEntryPointStats& operator [](NoiseEntryPoint entryPoint) const noexcept
+		{
+			return entryPoints[static_cast<std::size_t>(entryPoint)];
+		}
+	};
 
-		///////////////////////////////////////
-		//
-		//	Octave noise (The result is clamped to the range [-1, 1])
-		//
+	// Counts since the start of the program or the last ResetNoiseInstrumentation(), summed over all threads
+	[[nodiscard]]
+	NoiseInstrumentation GetNoiseInstrumentation();
 
-		[[nodiscard]]
-		value_type octave1D_11(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+	void ResetNoiseInstrumentation();
 
-		[[nodiscard]]
-		value_type octave2D_11(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+	///////////////////////////////////////
+	//
+	//	Runtime CPU dispatch
+	//
+	//	With SIVPERLIN_RUNTIME_DISPATCH defined as 1, the fillNoise / fillOctave / fillNormalizedOctave functions of float and double
+	//	are also compiled for AVX2 and AVX-512F, and the widest level the CPU supports is selected on the first fill.
+	//	A level is only used if it is wider than SIVPERLIN_SIMD_BYTES, and it gives the same results as the baseline.
+	//	The environment variable SIVPERLIN_SIMD_LEVEL (baseline, avx2 or avx512) and SetNoiseSimdLevel() can select a lower level for testing.
+	//	Without SIVPERLIN_RUNTIME_DISPATCH, or on compilers and CPUs other than GCC / Clang on x86, the level is always Baseline.
+	//
+	enum class NoiseSimdLevel : std::uint8_t
+	{
+		// Code for the compiler flags
+		Baseline,
 
-		[[nodiscard]]
-		value_type octave3D_11(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+		AVX2,
 
-		///////////////////////////////////////
-		//
-		//	Octave noise (The result is clamped and remapped to the range [0, 1])
-		//
+		AVX512,
+	};
 
-		[[nodiscard]]
-		value_type octave1D_01(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+	// Widest level supported by the CPU and the build
+	[[nodiscard]]
+	NoiseSimdLevel GetSupportedNoiseSimdLevel() noexcept;
 
-		[[nodiscard]]
-		value_type octave2D_01(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+	// Level used by the fills
+	[[nodiscard]]
+	NoiseSimdLevel GetNoiseSimdLevel() noexcept;
 
-		[[nodiscard]]
-		value_type octave3D_01(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+	// Selects the level used by the fills, lowered to GetSupportedNoiseSimdLevel(). Returns the level that is selected.
+	NoiseSimdLevel SetNoiseSimdLevel(NoiseSimdLevel level) noexcept;
 
-		///////////////////////////////////////
-		//
-		//	Octave noise (The result is normalized to the range [-1, 1])
-		//
 
-		[[nodiscard]]
-		value_type normalizedOctave1D(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+	///////////////////////////////////////
+	//
+	//	Fixed-point number with FractionalBits fractional bits
+	//
+	//	BasicPerlinNoise<BasicFixedPoint<...>> evaluates noise with integer arithmetic only,
+	//	so the result is bit-identical on every compiler and CPU regardless of floating-point settings.
+	//	Addition, subtraction and multiplication wrap around on overflow, and multiplication and division round toward negative infinity.
+	//	Since the noise only depends on the coordinates modulo 256, wrapped coordinates still give the same noise.
+	//
+	template <class Rep, std::int32_t FractionalBits>
+	class BasicFixedPoint
+	{
+	public:
 
-		[[nodiscard]]
-		value_type normalizedOctave2D(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+		static_assert(std::is_integral_v<Rep> && std::is_signed_v<Rep>);
+
+		static_assert((8 < FractionalBits) && (FractionalBits < static_cast<std::int32_t>(sizeof(Rep) * 8 - 8)));
+
+		using rep_type = Rep;
+
+		static constexpr std::int32_t fractional_bits = FractionalBits;
+
+		constexpr BasicFixedPoint() noexcept = default;
+
+		template <class Int, std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
+		constexpr BasicFixedPoint(const Int i) noexcept
+			: m_raw{ static_cast<Rep>(static_cast<unsigned_type>(i) << FractionalBits) } {}
+
+		// Rounds to the nearest representable value
+		template <class F, std::enable_if_t<std::is_floating_point_v<F>>* = nullptr>
+		explicit constexpr BasicFixedPoint(const F x) noexcept
+			: m_raw{ static_cast<Rep>(x * static_cast<F>(One) + (x < 0 ? F(-0.5) : F(0.5))) } {}
 
 		[[nodiscard]]
-		value_type normalizedOctave3D(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+		static constexpr BasicFixedPoint FromRaw(const Rep raw) noexcept
+		{
+			BasicFixedPoint result;
+			result.m_raw = raw;
+			return result;
+		}
 
-		///////////////////////////////////////
-		//
-		//	Octave noise (The result is normalized and remapped to the range [0, 1])
-		//
+		[[nodiscard]]
+		constexpr Rep raw() const noexcept
+		{
+			return m_raw;
+		}
 
+		// Rounds toward negative infinity
+		template <class Int, std::enable_if_t<std::is_integral_v<Int>>* = nullptr>
 		[[nodiscard]]
-		value_type normalizedOctave1D_01(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+		explicit constexpr operator Int() const noexcept
+		{
+			return static_cast<Int>(m_raw >> FractionalBits);
+		}
 
+		template <class F, std::enable_if_t<std::is_floating_point_v<F>>* = nullptr>
 		[[nodiscard]]
-		value_type normalizedOctave2D_01(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+		explicit constexpr operator F() const noexcept
+		{
+			return (static_cast<F>(m_raw) / static_cast<F>(One));
+		}
 
 		[[nodiscard]]
-		value_type normalizedOctave3D_01(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+		constexpr BasicFixedPoint operator +() const noexcept
+		{
+			return *this;
+		}
 
-	private:
+		[[nodiscard]]
+		constexpr BasicFixedPoint operator -() const noexcept
+		{
+			return FromRaw(static_cast<Rep>(unsigned_type(0) - static_cast<unsigned_type>(m_raw)));
+		}
 
-		state_type m_permutation;
-	};
+		constexpr BasicFixedPoint& operator +=(const BasicFixedPoint other) noexcept
+		{
+			m_raw = static_cast<Rep>(static_cast<unsigned_type>(m_raw) + static_cast<unsigned_type>(other.m_raw));
+			return *this;
+		}
 
-	using PerlinNoise = BasicPerlinNoise<double>;
+		constexpr BasicFixedPoint& operator -=(const BasicFixedPoint other) noexcept
+		{
+			m_raw = static_cast<Rep>(static_cast<unsigned_type>(m_raw) - static_cast<unsigned_type>(other.m_raw));
+			return *this;
+		}
 
-	namespace perlin_detail
-	{
-		////////////////////////////////////////////////
-		//
-		//	These functions are provided for consistency.
-		//	You may get different results from std::shuffle() with different standard library implementations.
-		//
-		SIVPERLIN_CONCEPT_URBG
-		[[nodiscard]]
-		inline std::uint64_t Random(const std::uint64_t max, URBG&& urbg)
+		constexpr BasicFixedPoint& operator *=(const BasicFixedPoint other) noexcept
 		{
-			return (urbg() % (max + 1));
+			m_raw = static_cast<Rep>((static_cast<wide_type>(m_raw) * other.m_raw) >> FractionalBits);
+			return *this;
 		}
 
-		template <class RandomIt, class URBG>
-		inline void Shuffle(RandomIt first, RandomIt last, URBG&& urbg)
+		// Division by zero gives zero
+		constexpr BasicFixedPoint& operator /=(const BasicFixedPoint other) noexcept
 		{
-			if (first == last)
+			if (other.m_raw == 0)
 			{
-				return;
+				m_raw = 0;
+				return *this;
 			}
 
-			using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+			const wide_type n = (static_cast<wide_type>(m_raw) * One);
+			wide_type q = (n / other.m_raw);
 
-			for (RandomIt it = first + 1; it < last; ++it)
+			if (((n % other.m_raw) != 0) && ((n < 0) != (other.m_raw < 0)))
 			{
-				const std::uint64_t n = static_cast<std::uint64_t>(it - first);
-				std::iter_swap(it, first + static_cast<difference_type>(Random(n, std::forward<URBG>(urbg))));
+				--q;
 			}
+
+			m_raw = static_cast<Rep>(q);
+			return *this;
 		}
-		//
-		////////////////////////////////////////////////
 
-		template <class Float>
 		[[nodiscard]]
-		inline constexpr Float Fade(const Float t) noexcept
+		friend constexpr BasicFixedPoint operator +(BasicFixedPoint a, const BasicFixedPoint b) noexcept
 		{
-			return t * t * t * (t * (t * 6 - 15) + 10);
+			return (a += b);
 		}
 
-		template <class Float>
 		[[nodiscard]]
-		inline constexpr Float Lerp(const Float a, const Float b, const Float t) noexcept
+		friend constexpr BasicFixedPoint operator -(BasicFixedPoint a, const BasicFixedPoint b) noexcept
 		{
-			return (a + (b - a) * t);
+			return (a -= b);
 		}
 
-		template <class Float>
 		[[nodiscard]]
-		inline constexpr Float Grad(const std::uint8_t hash, const Float x, const Float y, const Float z) noexcept
+		friend constexpr BasicFixedPoint operator *(BasicFixedPoint a, const BasicFixedPoint b) noexcept
 		{
-			const std::uint8_t h = hash & 15;
-			const Float u = h < 8 ? x : y;
-			const Float v = h < 4 ? y : h == 12 || h == 14 ? x : z;
-			return ((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v);
+			return (a *= b);
 		}
 
-		template <class Float>
 		[[nodiscard]]
-		inline constexpr Float Remap_01(const Float x) noexcept
+		friend constexpr BasicFixedPoint operator /(BasicFixedPoint a, const BasicFixedPoint b) noexcept
 		{
-			return (x * Float(0.5) + Float(0.5));
+			return (a /= b);
 		}
 
-		template <class Float>
 		[[nodiscard]]
-		inline constexpr Float Clamp_11(const Float x) noexcept
+		friend constexpr bool operator ==(const BasicFixedPoint a, const BasicFixedPoint b) noexcept
 		{
-			return std::clamp(x, Float(-1.0), Float(1.0));
+			return (a.m_raw == b.m_raw);
 		}
 
-		template <class Float>
 		[[nodiscard]]
-		inline constexpr Float RemapClamp_01(const Float x) noexcept
+		friend constexpr bool operator !=(const BasicFixedPoint a, const BasicFixedPoint b) noexcept
 		{
-			if (x <= Float(-1.0))
-			{
-				return Float(0.0);
-			}
-			else if (Float(1.0) <= x)
-			{
-				return Float(1.0);
-			}
-
-			return (x * Float(0.5) + Float(0.5));
+			return (a.m_raw != b.m_raw);
 		}
 
-		template <class Noise, class Float>
 		[[nodiscard]]
-		inline auto Octave1D(const Noise& noise, Float x, const std::int32_t octaves, const Float persistence) noexcept
+		friend constexpr bool operator <(const BasicFixedPoint a, const BasicFixedPoint b) noexcept
 		{
-			using value_type = Float;
-			value_type result = 0;
-			value_type amplitude = 1;
-
-			for (std::int32_t i = 0; i < octaves; ++i)
-			{
-				result += (noise.noise1D(x) * amplitude);
-				x *= 2;
-				amplitude *= persistence;
-			}
-
-			return result;
+			return (a.m_raw < b.m_raw);
 		}
 
-		template <class Noise, class Float>
 		[[nodiscard]]
-		inline auto Octave2D(const Noise& noise, Float x, Float y, const std::int32_t octaves, const Float persistence) noexcept
+		friend constexpr bool operator <=(const BasicFixedPoint a, const BasicFixedPoint b) noexcept
 		{
-			using value_type = Float;
-			value_type result = 0;
-			value_type amplitude = 1;
-
-			for (std::int32_t i = 0; i < octaves; ++i)
-			{
-				result += (noise.noise2D(x, y) * amplitude);
-				x *= 2;
-				y *= 2;
-				amplitude *= persistence;
-			}
+			return (a.m_raw <= b.m_raw);
+		}
 
-			return result;
+		[[nodiscard]]
+		friend constexpr bool operator >(const BasicFixedPoint a, const BasicFixedPoint b) noexcept
+		{
+			return (a.m_raw > b.m_raw);
 		}
 
-		template <class Noise, class Float>
 		[[nodiscard]]
-		inline auto Octave3D(const Noise& noise, Float x, Float y, Float z, const std::int32_t octaves, const Float persistence) noexcept
+		friend constexpr bool operator >=(const BasicFixedPoint a, const BasicFixedPoint b) noexcept
 		{
-			using value_type = Float;
-			value_type result = 0;
-			value_type amplitude = 1;
+			return (a.m_raw >= b.m_raw);
+		}
+
+	private:
+
+		using unsigned_type = std::make_unsigned_t<Rep>;
+
+	# if defined(__SIZEOF_INT128__)
+		__extension__ typedef __int128 int128_type;
+		using wide_type = std::conditional_t<(sizeof(Rep) <= 4), std::int64_t, int128_type>;
+	# else
+		static_assert((sizeof(Rep) <= 4), "64-bit BasicFixedPoint requires a 128-bit integer type");
+		using wide_type = std::int64_t;
+	# endif
+
+		static constexpr Rep One = (Rep(1) << FractionalBits);
+
+		Rep m_raw = 0;
+	};
+
+	// Q16.16
+	using FixedPoint32 = BasicFixedPoint<std::int32_t, 16>;
+
+# if defined(__SIZEOF_INT128__)
+
+	// Q32.32
+	using FixedPoint64 = BasicFixedPoint<std::int64_t, 32>;
+
+# endif
+
+	namespace perlin_detail
+	{
+		template <class To, class From>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 To BitCast(const From& from) noexcept
+		{
+			static_assert(sizeof(To) == sizeof(From));
+
+		# if __cpp_lib_bit_cast
+			return std::bit_cast<To>(from);
+		# else
+			To to;
+			std::memcpy(&to, &from, sizeof(To));
+			return to;
+		# endif
+		}
+
+		// Rounds to nearest even. Values too large for binary16 become infinity.
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 std::uint16_t FloatToHalf(const float f) noexcept
+		{
+			const std::uint32_t bits = BitCast<std::uint32_t>(f);
+			const std::uint32_t sign = ((bits >> 16) & 0x8000u);
+			std::uint32_t a = (bits & 0x7FFF'FFFFu);
+
+			if (0x4780'0000u <= a) // 65536 or more, infinity or NaN
+			{
+				return static_cast<std::uint16_t>(sign | ((0x7F80'0000u < a) ? 0x7E00u : 0x7C00u));
+			}
+			else if (a < 0x3880'0000u) // Less than 2^-14: subnormal or zero
+			{
+				// Adding 0.5f aligns the subnormal mantissa to the last bit and rounds it
+				const float t = (BitCast<float>(a) + 0.5f);
+				return static_cast<std::uint16_t>(sign | (BitCast<std::uint32_t>(t) - 0x3F00'0000u));
+			}
+			else
+			{
+				const std::uint32_t odd = ((a >> 13) & 1u);
+				a += (0xC800'0FFFu + odd); // Rebias the exponent from 127 to 15 and round
+				return static_cast<std::uint16_t>(sign | (a >> 13));
+			}
+		}
+
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 float HalfToFloat(const std::uint16_t h) noexcept
+		{
+			const std::uint32_t sign = (static_cast<std::uint32_t>(h & 0x8000u) << 16);
+			const std::uint32_t exponent = ((h >> 10) & 0x1Fu);
+			const std::uint32_t mantissa = (h & 0x3FFu);
+
+			if (exponent == 0)
+			{
+				const float f = (static_cast<float>(mantissa) * 0x1p-24f);
+				return (sign ? -f : f);
+			}
+			else if (exponent == 0x1F)
+			{
+				return BitCast<float>(sign | 0x7F80'0000u | (mantissa << 13));
+			}
+			else
+			{
+				return BitCast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+			}
+		}
+	}
+
+	///////////////////////////////////////
+	//
+	//	IEEE 754 binary16 (half precision) storage for the batch functions
+	//
+	struct Half
+	{
+		std::uint16_t bits = 0;
+
+		constexpr Half() noexcept = default;
+
+		explicit SIVPERLIN_CONSTEXPR_CXX20 Half(const float f) noexcept
+			: bits{ perlin_detail::FloatToHalf(f) } {}
+
+		[[nodiscard]]
+		explicit SIVPERLIN_CONSTEXPR_CXX20 operator float() const noexcept
+		{
+			return perlin_detail::HalfToFloat(bits);
+		}
+	};
+
+	namespace perlin_detail
+	{
+		template <class T>
+		inline constexpr bool IsFixedPoint = false;
+
+		template <class Rep, std::int32_t FractionalBits>
+		inline constexpr bool IsFixedPoint<BasicFixedPoint<Rep, FractionalBits>> = true;
+
+		template <class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 Float Floor(const Float x) noexcept
+		{
+		# if __cpp_lib_is_constant_evaluated
+			if (std::is_constant_evaluated())
+			{
+				// Values of this magnitude (and NaN) have no fractional part
+				if (!((-Float(1LL << 52) < x) && (x < Float(1LL << 52))))
+				{
+					return x;
+				}
+
+				const Float i = static_cast<Float>(static_cast<std::int64_t>(x));
+
+				return ((x < i) ? (i - 1) : i);
+			}
+		# endif
+
+			return std::floor(x);
+		}
+
+		template <class Rep, std::int32_t FractionalBits>
+		[[nodiscard]]
+		inline constexpr BasicFixedPoint<Rep, FractionalBits> Floor(const BasicFixedPoint<Rep, FractionalBits> x) noexcept
+		{
+			return BasicFixedPoint<Rep, FractionalBits>::FromRaw(x.raw() & ~((Rep(1) << FractionalBits) - 1));
+		}
+
+		using PermutationTable = std::array<std::uint8_t, 512>;
+
+		[[nodiscard]]
+		inline constexpr PermutationTable ExpandPermutation(const std::array<std::uint8_t, 256>& state) noexcept
+		{
+			PermutationTable table{};
+
+			for (std::size_t i = 0; i < state.size(); ++i)
+			{
+				table[i] = state[i];
+				table[i + 256] = state[i];
+			}
+
+			return table;
+		}
+	}
+
+	template <class Float, NoiseKernel Kernel = NoiseKernel::Compatible>
+	class BasicPerlinNoise
+	{
+	public:
+
+		static_assert(std::is_floating_point_v<Float> || perlin_detail::IsFixedPoint<Float>);
+
+		///////////////////////////////////////
+		//
+		//	Typedefs
+		//
+
+		using state_type = std::array<std::uint8_t, 256>;
+
+		using value_type = Float;
+
+		using default_random_engine = std::mt19937;
+
+		using seed_type = typename default_random_engine::result_type;
+
+		using grid_type = BasicNoiseGrid<Float>;
+
+		using derivative2D_type = BasicNoiseDerivative2D<Float>;
+
+		using derivative3D_type = BasicNoiseDerivative3D<Float>;
+
+		using warp_type = BasicNoiseWarp<Float>;
+
+		static constexpr NoiseKernel kernel = Kernel;
+
+		///////////////////////////////////////
+		//
+		//	Constructors
+		//
+
+		SIVPERLIN_NODISCARD_CXX20
+		constexpr BasicPerlinNoise() noexcept;
+
+		SIVPERLIN_NODISCARD_CXX20
+		explicit BasicPerlinNoise(seed_type seed);
+
+		SIVPERLIN_CONCEPT_URBG
+		SIVPERLIN_NODISCARD_CXX20
+		explicit BasicPerlinNoise(URBG&& urbg);
+
+		///////////////////////////////////////
+		//
+		//	Reseed
+		//
+
+		void reseed(seed_type seed);
+
+		SIVPERLIN_CONCEPT_URBG
+		void reseed(URBG&& urbg);
+
+		// Shuffles with SplitMix64 and unbiased bounded draws instead of std::mt19937.
+		// Much cheaper than reseed(seed_type), but gives a different permutation for the same seed.
+		// Not constexpr before C++20 with SIVPERLIN_ENABLE_INSTRUMENTATION, so that the call is counted.
+		SIVPERLIN_CONSTEXPR_INSTRUMENTED void reseedFast(std::uint64_t seed) noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Serialization
+		//
+
+		[[nodiscard]]
+		constexpr state_type serialize() const noexcept;
+
+		constexpr void deserialize(const state_type& state) noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Noise (The result is in the range [-1, 1])
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type noise1D(value_type x) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type noise2D(value_type x, value_type y) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type noise3D(value_type x, value_type y, value_type z) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Noise (The result is remapped to the range [0, 1])
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type noise1D_01(value_type x) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type noise2D_01(value_type x, value_type y) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type noise3D_01(value_type x, value_type y, value_type z) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Octave noise (The result can be out of the range [-1, 1])
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type octave1D(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type octave2D(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type octave3D(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Octave noise (The result is clamped to the range [-1, 1])
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type octave1D_11(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type octave2D_11(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type octave3D_11(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Octave noise (The result is clamped and remapped to the range [0, 1])
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type octave1D_01(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type octave2D_01(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type octave3D_01(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Octave noise (The result is normalized to the range [-1, 1])
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type normalizedOctave1D(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type normalizedOctave2D(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type normalizedOctave3D(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Octave noise (The result is normalized and remapped to the range [0, 1])
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type normalizedOctave1D_01(value_type x, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type normalizedOctave2D_01(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type normalizedOctave3D_01(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Batch (Fills dst with the same values as the functions above, evaluated on a regular grid)
+		//
+		//	Several samples are evaluated together in SIMD-friendly blocks.
+		//	The results match the scalar functions except for the rounding
+		//	differences caused by floating-point contraction (FMA):
+		//	within 1e-12 for double and 1e-5 for float.
+		//
+		//	dst may also be of another floating-point type or Half.
+		//	The _01 functions also accept std::uint8_t and std::uint16_t, scaled to [0, max] and rounded to nearest.
+		//
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNoise2D(Output* dst, const grid_type& grid) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNoise3D(Output* dst, const grid_type& grid) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNoise2D_01(Output* dst, const grid_type& grid) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNoise3D_01(Output* dst, const grid_type& grid) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave2D(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave3D(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave2D_11(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave3D_11(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave2D_01(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave3D_01(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNormalizedOctave2D(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNormalizedOctave3D(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNormalizedOctave2D_01(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNormalizedOctave3D_01(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		// Fills `levels` levels of detail of fillOctave2D(). Level L has ((width + 2^L - 1) >> L) x ((height + 2^L - 1) >> L) samples
+		// at the positions of samples (i << L, j << L) of grid, with NoisePyramidOctaves(grid, L, octaves) octaves, stored in dst[L].
+		// The coarse levels are taken from the partial sums of level 0, so the whole pyramid costs about as much as level 0.
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave2DPyramid(Output* const* dst, const grid_type& grid, std::size_t levels, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Noise with its analytic gradient (value is the same as noiseND() / octaveND())
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 derivative2D_type noise2DDerivative(value_type x, value_type y) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 derivative3D_type noise3DDerivative(value_type x, value_type y, value_type z) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 derivative2D_type octave2DDerivative(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 derivative3D_type octave3DDerivative(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNoise2DDerivative(derivative2D_type* dst, const grid_type& grid) const noexcept;
+
+		SIVPERLIN_CONSTEXPR_CXX20 void fillNoise3DDerivative(derivative3D_type* dst, const grid_type& grid) const noexcept;
+
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave2DDerivative(derivative2D_type* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave3DDerivative(derivative3D_type* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Domain-warped octave noise (octaveND() at the position displaced by warp)
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type warpedOctave2D(value_type x, value_type y, const warp_type& warp, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type warpedOctave3D(value_type x, value_type y, value_type z, const warp_type& warp, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillWarpedOctave2D(Output* dst, const grid_type& grid, const warp_type& warp, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillWarpedOctave3D(Output* dst, const grid_type& grid, const warp_type& warp, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillWarpedOctave2D_01(Output* dst, const grid_type& grid, const warp_type& warp, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillWarpedOctave3D_01(Output* dst, const grid_type& grid, const warp_type& warp, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		///////////////////////////////////////
+		//
+		//	Periodic noise (The lattice coordinates wrap at period along each axis, so the noise tiles with that period. period >= 1)
+		//
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type periodicNoise1D(value_type x, std::int32_t periodX) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type periodicNoise2D(value_type x, value_type y, std::int32_t periodX, std::int32_t periodY) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type periodicNoise3D(value_type x, value_type y, value_type z, std::int32_t periodX, std::int32_t periodY, std::int32_t periodZ) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type periodicOctave1D(value_type x, std::int32_t periodX, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type periodicOctave2D(value_type x, value_type y, std::int32_t periodX, std::int32_t periodY, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 value_type periodicOctave3D(value_type x, value_type y, value_type z, std::int32_t periodX, std::int32_t periodY, std::int32_t periodZ, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillPeriodicOctave2D(Output* dst, const grid_type& grid, std::int32_t periodX, std::int32_t periodY, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillPeriodicOctave3D(Output* dst, const grid_type& grid, std::int32_t periodX, std::int32_t periodY, std::int32_t periodZ, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillPeriodicOctave2D_01(Output* dst, const grid_type& grid, std::int32_t periodX, std::int32_t periodY, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillPeriodicOctave3D_01(Output* dst, const grid_type& grid, std::int32_t periodX, std::int32_t periodY, std::int32_t periodZ, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+	private:
+
+		// The permutation repeated twice, so that the hash chain in the noise functions never needs to wrap an index
+		alignas(64) perlin_detail::PermutationTable m_permutation;
+	};
+
+	using PerlinNoise = BasicPerlinNoise<double>;
+
+	using FixedPerlinNoise = BasicPerlinNoise<FixedPoint32>;
+
+	///////////////////////////////////////
+	//
+	//	Thread pool for ParallelFill()
+	//
+	//	parallelFor() gives each worker a contiguous block of indices.
+	//	A worker that runs out of work steals the second half of another worker's remaining block.
+	//
+	class NoiseThreadPool
+	{
+	public:
+
+		// threadCount == 0 uses std::thread::hardware_concurrency()
+		SIVPERLIN_NODISCARD_CXX20
+		explicit NoiseThreadPool(std::size_t threadCount = 0);
+
+		NoiseThreadPool(const NoiseThreadPool&) = delete;
+
+		NoiseThreadPool& operator =(const NoiseThreadPool&) = delete;
+
+		~NoiseThreadPool();
+
+		[[nodiscard]]
+		std::size_t threadCount() const noexcept;
+
+		// Calls task(i) for every i in [0, count) on the worker threads and waits for all of them. task must not throw.
+		template <class Task>
+		void parallelFor(std::size_t count, Task&& task);
+
+	private:
+
+		struct Range
+		{
+			std::mutex mutex;
+
+			std::size_t begin = 0, end = 0;
+		};
+
+		std::vector<std::thread> m_threads;
+
+		std::unique_ptr<Range[]> m_ranges;
+
+		std::mutex m_jobMutex;
+
+		std::mutex m_mutex;
+
+		std::condition_variable m_wake;
+
+		std::condition_variable m_done;
+
+		void (*m_invoke)(void*, std::size_t) = nullptr;
+
+		void* m_task = nullptr;
+
+		std::uint64_t m_generation = 0;
+
+		std::size_t m_active = 0;
+
+		bool m_stop = false;
+
+		void run(std::size_t worker);
+
+		bool next(std::size_t worker, std::size_t& index);
+	};
+
+	// Fills a 2D or 3D grid on the pool. fill(dst, grid) is called for each tile (a band of rows of one slice).
+	// The result does not depend on the number of threads.
+	// For NUMA systems, allocate dst without initializing it so that each page is first touched by the worker that fills it.
+	template <class Output, class Float, class Fill>
+	void ParallelFill(NoiseThreadPool& pool, Output* dst, const BasicNoiseGrid<Float>& grid, Fill&& fill);
+
+	// Same as above, using a temporary pool of threadCount threads
+	template <class Output, class Float, class Fill>
+	void ParallelFill(Output* dst, const BasicNoiseGrid<Float>& grid, Fill&& fill, std::size_t threadCount = 0);
+
+	///////////////////////////////////////
+	//
+	//	Thread-safe cache of octave noise tiles
+	//
+	//	Tile (tx, ty, tz) holds tileSize^2 (2D) or tileSize^3 (3D) samples spaced by step,
+	//	starting at (tx, ty, tz) * tileSize * step, filled by fillOctave2D() / fillOctave3D().
+	//	Tiles are keyed by the permutation state of the noise, the tile coordinates, octaves and persistence.
+	//	The least recently used tiles are evicted when more than capacity tiles are cached.
+	//	A request for a tile that is being generated by another thread waits for it instead of generating it again.
+	//
+	template <class Float, NoiseKernel Kernel = NoiseKernel::Compatible>
+	class BasicNoiseTileCache
+	{
+	public:
+
+		using noise_type = BasicPerlinNoise<Float, Kernel>;
+
+		using value_type = Float;
+
+		using tile_type = std::shared_ptr<const std::vector<Float>>;
+
+		struct Statistics
+		{
+			// Requests served from the cache, including those that waited for a tile in progress
+			std::uint64_t hits = 0;
+
+			// Requests that generated a tile
+			std::uint64_t misses = 0;
+
+			std::uint64_t evictions = 0;
+
+			// Number of cached tiles
+			std::size_t size = 0;
+		};
+
+		// capacity == 0 is treated as 1
+		SIVPERLIN_NODISCARD_CXX20
+		BasicNoiseTileCache(std::size_t tileSize, value_type step, std::size_t capacity);
+
+		BasicNoiseTileCache(const BasicNoiseTileCache&) = delete;
+
+		BasicNoiseTileCache& operator =(const BasicNoiseTileCache&) = delete;
+
+		// Samples are stored at [j * tileSize + i]
+		[[nodiscard]]
+		tile_type octave2D(const noise_type& noise, std::int64_t tx, std::int64_t ty, std::int32_t octaves, value_type persistence = value_type(0.5));
+
+		// Samples are stored at [(k * tileSize + j) * tileSize + i]
+		[[nodiscard]]
+		tile_type octave3D(const noise_type& noise, std::int64_t tx, std::int64_t ty, std::int64_t tz, std::int32_t octaves, value_type persistence = value_type(0.5));
+
+		[[nodiscard]]
+		Statistics statistics() const;
+
+		// Removes all tiles. Tiles already returned stay valid.
+		void clear();
+
+		[[nodiscard]]
+		std::size_t tileSize() const noexcept;
+
+		[[nodiscard]]
+		value_type step() const noexcept;
+
+		[[nodiscard]]
+		std::size_t capacity() const noexcept;
+
+	private:
+
+		struct Key
+		{
+			typename noise_type::state_type state;
+
+			std::int64_t tx, ty, tz;
+
+			std::int32_t dimension, octaves;
+
+			value_type persistence;
+
+			[[nodiscard]]
+			friend bool operator ==(const Key& a, const Key& b) noexcept
+			{
+				return ((a.tx == b.tx) && (a.ty == b.ty) && (a.tz == b.tz)
+					&& (a.dimension == b.dimension) && (a.octaves == b.octaves)
+					&& (a.persistence == b.persistence) && (a.state == b.state));
+			}
+		};
+
+		struct KeyHash
+		{
+			[[nodiscard]]
+			std::size_t operator ()(const Key& key) const noexcept;
+		};
+
+		struct Entry
+		{
+			std::shared_future<tile_type> tile;
+
+			// Position in m_order
+			typename std::list<Key>::iterator position;
+
+			std::uint64_t id = 0;
+		};
+
+		std::size_t m_tileSize;
+
+		value_type m_step;
+
+		std::size_t m_capacity;
+
+		mutable std::mutex m_mutex;
+
+		// Most recently used first
+		std::list<Key> m_order;
+
+		std::unordered_map<Key, Entry, KeyHash> m_entries;
+
+		Statistics m_statistics;
+
+		std::uint64_t m_nextID = 0;
+
+		tile_type get(const noise_type& noise, const Key& key);
+	};
+
+	using NoiseTileCache = BasicNoiseTileCache<double>;
+
+	///////////////////////////////////////
+	//
+	//	Asynchronous generation of octave noise chunks
+	//
+	//	octave2D() / octave3D() queue the fillOctave2D() / fillOctave3D() of a grid and return at once.
+	//	The chunks are generated on the worker threads of the generator, higher priority first and in submission order for equal priorities.
+	//	A pending chunk that is cancelled is never generated, and a chunk that is being generated stops at its next band of rows.
+	//	The future of a cancelled chunk holds nullptr. The destructor cancels all chunks that are not ready.
+	//
+	template <class Float, NoiseKernel Kernel = NoiseKernel::Compatible>
+	class BasicNoiseChunkGenerator
+	{
+	public:
+
+		using noise_type = BasicPerlinNoise<Float, Kernel>;
+
+		using value_type = Float;
+
+		using grid_type = BasicNoiseGrid<Float>;
+
+		using chunk_type = std::shared_ptr<const std::vector<Float>>;
+
+		enum class Status : std::uint8_t
+		{
+			Pending,
+
+			Running,
+
+			Ready,
+
+			Cancelled,
+		};
+
+	private:
+
+		struct Job;
+
+	public:
+
+		// Handle of a queued chunk. Copies refer to the same chunk.
+		class Request
+		{
+		public:
+
+			Request() = default;
+
+			// Becomes ready with the samples in the order of fillOctave2D() / fillOctave3D(), or nullptr if the chunk is cancelled
+			[[nodiscard]]
+			const std::shared_future<chunk_type>& future() const noexcept;
+
+			// Returns Status::Cancelled if the request is not valid()
+			[[nodiscard]]
+			Status status() const noexcept;
+
+			// Returns false if the chunk is already ready or cancelled, or if the request is not valid()
+			bool cancel() noexcept;
+
+			[[nodiscard]]
+			bool valid() const noexcept;
+
+		private:
+
+			friend BasicNoiseChunkGenerator;
+
+			std::shared_ptr<Job> m_job;
+
+			std::shared_future<chunk_type> m_future;
+
+			Request(std::shared_ptr<Job> job, std::shared_future<chunk_type> future) noexcept;
+		};
+
+		// threadCount == 0 uses std::thread::hardware_concurrency()
+		SIVPERLIN_NODISCARD_CXX20
+		explicit BasicNoiseChunkGenerator(const noise_type& noise, std::size_t threadCount = 0);
+
+		BasicNoiseChunkGenerator(const BasicNoiseChunkGenerator&) = delete;
+
+		BasicNoiseChunkGenerator& operator =(const BasicNoiseChunkGenerator&) = delete;
+
+		~BasicNoiseChunkGenerator();
+
+		// Queues fillOctave2D() of grid.width x grid.height samples
+		[[nodiscard]]
+		Request octave2D(const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5), std::int32_t priority = 0);
+
+		// Queues fillOctave3D() of grid.width x grid.height x grid.depth samples
+		[[nodiscard]]
+		Request octave3D(const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5), std::int32_t priority = 0);
+
+		// Cancels all chunks that are not ready
+		void cancelAll();
+
+		[[nodiscard]]
+		std::size_t threadCount() const noexcept;
+
+		[[nodiscard]]
+		const noise_type& noise() const noexcept;
+
+	private:
+
+		struct Job
+		{
+			grid_type grid;
+
+			std::int32_t dimension, octaves;
+
+			value_type persistence;
+
+			std::promise<chunk_type> promise;
+
+			std::atomic<Status> status{ Status::Pending };
+		};
+
+		struct QueueEntry
+		{
+			std::int32_t priority;
+
+			std::uint64_t sequence;
+
+			std::shared_ptr<Job> job;
+
+			// std::priority_queue pops the greatest entry: the highest priority, then the lowest sequence
+			[[nodiscard]]
+			friend bool operator <(const QueueEntry& a, const QueueEntry& b) noexcept
+			{
+				return ((a.priority != b.priority) ? (a.priority < b.priority) : (b.sequence < a.sequence));
+			}
+		};
+
+		noise_type m_noise;
+
+		std::vector<std::thread> m_threads;
+
+		mutable std::mutex m_mutex;
+
+		std::condition_variable m_wake;
+
+		std::priority_queue<QueueEntry> m_queue;
+
+		// Jobs that are being generated, for cancelAll()
+		std::vector<std::shared_ptr<Job>> m_running;
+
+		std::uint64_t m_nextSequence = 0;
+
+		bool m_stop = false;
+
+		Request submit(const grid_type& grid, std::int32_t dimension, std::int32_t octaves, value_type persistence, std::int32_t priority);
+
+		void run();
+
+		// Returns false if job is stopped by its status
+		bool generate(Job& job, std::vector<Float>& samples) const noexcept;
+
+		// A pending job is resolved with nullptr here. A running job is resolved by its worker.
+		static bool Cancel(Job& job) noexcept;
+	};
+
+	using NoiseChunkGenerator = BasicNoiseChunkGenerator<double>;
+
+	///////////////////////////////////////
+	//
+	//	Scrolling window of octave noise
+	//
+	//	Holds the width x height samples of fillOctave2D(grid) in a ring buffer.
+	//	scroll(dx, dy) moves the window by whole samples (offsetX += dx, offsetY += dy)
+	//	and evaluates only the rows and columns that become visible,
+	//	so the cost is proportional to the motion rather than to the window size.
+	//	The samples are the same as those of a full fillOctave2D() at the current position.
+	//
+	template <class Float, NoiseKernel Kernel = NoiseKernel::Compatible>
+	class BasicNoiseWindow
+	{
+	public:
+
+		using noise_type = BasicPerlinNoise<Float, Kernel>;
+
+		using value_type = Float;
+
+		using grid_type = BasicNoiseGrid<Float>;
+
+		// A rectangle of the window that is contiguous in the ring buffer. Rows are stride() samples apart.
+		struct View
+		{
+			const value_type* data = nullptr;
+
+			// Position of the rectangle in the window
+			std::size_t x = 0, y = 0;
+
+			std::size_t width = 0, height = 0;
+		};
+
+		SIVPERLIN_NODISCARD_CXX20
+		BasicNoiseWindow(const noise_type& noise, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5));
+
+		void scroll(std::int64_t dx, std::int64_t dy);
+
+		// Same as scroll(offsetX - grid().offsetX, offsetY - grid().offsetY)
+		void moveTo(std::int64_t offsetX, std::int64_t offsetY);
+
+		// The current position. Its offsets change with scroll().
+		[[nodiscard]]
+		const grid_type& grid() const noexcept;
+
+		// Sample (i, j) of the window
+		[[nodiscard]]
+		value_type operator ()(std::size_t i, std::size_t j) const noexcept;
+
+		// The window as up to 4 rectangles of the ring buffer, without copying. Unused views are empty.
+		[[nodiscard]]
+		std::array<View, 4> views() const noexcept;
+
+		[[nodiscard]]
+		std::size_t stride() const noexcept;
+
+		// Copies the window to dst[j * width + i]
+		void copyTo(value_type* dst) const noexcept;
+
+	private:
+
+		noise_type m_noise;
+
+		grid_type m_grid;
+
+		std::int32_t m_octaves;
+
+		value_type m_persistence;
+
+		std::vector<value_type> m_data;
+
+		// Position of sample (0, 0) in m_data
+		std::size_t m_column = 0, m_row = 0;
+
+		// Evaluates the columns [begin, end) of row j
+		void update(std::size_t j, std::size_t begin, std::size_t end) noexcept;
+	};
+
+	using NoiseWindow = BasicNoiseWindow<double>;
+
+	///////////////////////////////////////
+	//
+	//	Level-of-detail pyramid of octave noise
+	//
+	//	Level 0 samples grid, and each further level halves the resolution.
+	//	Octaves shorter than two samples of a level are dropped (NoisePyramidOctaves()), including on level 0,
+	//	and all levels are generated in one pass with fillOctave2DPyramid().
+	//
+	template <class Float, NoiseKernel Kernel = NoiseKernel::Compatible>
+	class BasicNoisePyramid
+	{
+	public:
+
+		using noise_type = BasicPerlinNoise<Float, Kernel>;
+
+		using value_type = Float;
+
+		using grid_type = BasicNoiseGrid<Float>;
+
+		struct Level
+		{
+			std::size_t width = 0, height = 0;
+
+			std::int32_t octaves = 0;
+
+			// Sample (i, j) is at data[j * width + i], at the position of sample (i << level, j << level) of the grid
+			std::vector<value_type> data;
+		};
+
+		SIVPERLIN_NODISCARD_CXX20
+		BasicNoisePyramid() = default;
+
+		// levels is limited to the number of levels down to 1 x 1 samples
+		SIVPERLIN_NODISCARD_CXX20
+		BasicNoisePyramid(const noise_type& noise, const grid_type& grid, std::size_t levels, std::int32_t octaves, value_type persistence = value_type(0.5));
+
+		[[nodiscard]]
+		std::size_t levels() const noexcept;
+
+		[[nodiscard]]
+		const Level& level(std::size_t level) const noexcept;
+
+	private:
+
+		std::vector<Level> m_levels;
+	};
+
+	using NoisePyramid = BasicNoisePyramid<double>;
+
+	///////////////////////////////////////
+	//
+	//	K independent noises evaluated together
+	//
+	//	Holds K permutation tables and evaluates all of them at the same coordinates.
+	//	The lattice cell, the fractional coordinates and the fade curves are computed once per sample,
+	//	and only the corner hashes and gradients are evaluated per table.
+	//	Each result is the same as that of the corresponding BasicPerlinNoise.
+	//
+	template <class Float, std::size_t K, NoiseKernel Kernel = NoiseKernel::Compatible>
+	class BasicNoiseBank
+	{
+	public:
+
+		static_assert(0 < K);
+
+		using noise_type = BasicPerlinNoise<Float, Kernel>;
+
+		using value_type = Float;
+
+		using seed_type = typename noise_type::seed_type;
+
+		using state_type = typename noise_type::state_type;
+
+		using grid_type = BasicNoiseGrid<Float>;
+
+		using result_type = std::array<Float, K>;
+
+		static constexpr std::size_t size = K;
+
+		// Every noise is BasicPerlinNoise()
+		SIVPERLIN_NODISCARD_CXX20
+		constexpr BasicNoiseBank() noexcept;
+
+		// Noise k is BasicPerlinNoise(seeds[k])
+		SIVPERLIN_NODISCARD_CXX20
+		explicit BasicNoiseBank(const std::array<seed_type, K>& seeds);
+
+		constexpr void set(std::size_t index, const noise_type& noise) noexcept;
+
+		[[nodiscard]]
+		constexpr noise_type noise(std::size_t index) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 result_type noise2D(value_type x, value_type y) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 result_type noise3D(value_type x, value_type y, value_type z) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 result_type octave2D(value_type x, value_type y, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		[[nodiscard]]
+		SIVPERLIN_CONSTEXPR_CXX20 result_type octave3D(value_type x, value_type y, value_type z, std::int32_t octaves, value_type persistence = value_type(0.5)) const noexcept;
+
+		// dst holds K * (number of samples of grid) elements
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave2D(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5), NoiseBankLayout layout = NoiseBankLayout::Interleaved) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave3D(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5), NoiseBankLayout layout = NoiseBankLayout::Interleaved) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave2D_01(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5), NoiseBankLayout layout = NoiseBankLayout::Interleaved) const noexcept;
+
+		template <class Output>
+		SIVPERLIN_CONSTEXPR_CXX20 void fillOctave3D_01(Output* dst, const grid_type& grid, std::int32_t octaves, value_type persistence = value_type(0.5), NoiseBankLayout layout = NoiseBankLayout::Interleaved) const noexcept;
+
+	private:
+
+		alignas(64) std::array<perlin_detail::PermutationTable, K> m_permutations;
+	};
+
+	template <std::size_t K>
+	using NoiseBank = BasicNoiseBank<double, K>;
+
+	namespace perlin_detail
+	{
+		////////////////////////////////////////////////
+		//
+		//	These functions are provided for consistency.
+		//	You may get different results from std::shuffle() with different standard library implementations.
+		//
+		SIVPERLIN_CONCEPT_URBG
+		[[nodiscard]]
+		inline std::uint64_t Random(const std::uint64_t max, URBG&& urbg)
+		{
+			return (urbg() % (max + 1));
+		}
+
+		template <class RandomIt, class URBG>
+		inline void Shuffle(RandomIt first, RandomIt last, URBG&& urbg)
+		{
+			if (first == last)
+			{
+				return;
+			}
+
+			using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+			for (RandomIt it = first + 1; it < last; ++it)
+			{
+				const std::uint64_t n = static_cast<std::uint64_t>(it - first);
+				std::iter_swap(it, first + static_cast<difference_type>(Random(n, std::forward<URBG>(urbg))));
+			}
+		}
+		//
+		////////////////////////////////////////////////
+
+		// SplitMix64 (Steele, Lea and Flood). 8 bytes of state, and any seed is a good seed.
+		class SplitMix64
+		{
+		public:
+
+			explicit constexpr SplitMix64(const std::uint64_t seed) noexcept
+				: m_state{ seed } {}
+
+			[[nodiscard]]
+			constexpr std::uint64_t operator ()() noexcept
+			{
+				std::uint64_t z = (m_state += 0x9E3779B97F4A7C15ull);
+				z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull);
+				z = ((z ^ (z >> 27)) * 0x94D049BB133111EBull);
+				return (z ^ (z >> 31));
+			}
+
+		private:
+
+			std::uint64_t m_state;
+		};
+
+		// Same Fisher-Yates order as Shuffle(), but with SplitMix64 and unbiased bounded draws
+		// (Lemire, "Fast Random Integer Generation in an Interval"). Each draw uses 16 bits, so one SplitMix64 output covers four swaps.
+		[[nodiscard]]
+		inline constexpr std::array<std::uint8_t, 256> ShuffledIdentity(const std::uint64_t seed) noexcept
+		{
+			std::array<std::uint8_t, 256> state{};
+
+			for (std::size_t i = 0; i < state.size(); ++i)
+			{
+				state[i] = static_cast<std::uint8_t>(i);
+			}
+
+			SplitMix64 rng{ seed };
+			std::uint64_t bits = 0;
+
+			for (std::uint32_t i = 1; i < 256; ++i)
+			{
+				if ((i & 3) == 1)
+				{
+					bits = rng();
+				}
+
+				// Uniform in [0, i]
+				const std::uint32_t bound = (i + 1);
+				std::uint32_t m = (static_cast<std::uint32_t>(bits & 0xFFFF) * bound);
+				bits >>= 16;
+
+				if ((m & 0xFFFF) < bound)
+				{
+					const std::uint32_t threshold = ((0x10000 - bound) % bound);
+
+					while ((m & 0xFFFF) < threshold)
+					{
+						m = (static_cast<std::uint32_t>(rng() >> 48) * bound);
+					}
+				}
+
+				const std::uint32_t k = (m >> 16);
+				const std::uint8_t t = state[i];
+				state[i] = state[k];
+				state[k] = t;
+			}
+
+			return state;
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float Fade(const Float t) noexcept
+		{
+			return t * t * t * (t * (t * 6 - 15) + 10);
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float Lerp(const Float a, const Float b, const Float t) noexcept
+		{
+			return (a + (b - a) * t);
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float Grad(const std::int32_t hash, const Float x, const Float y, const Float z) noexcept
+		{
+			const std::int32_t h = hash & 15;
+			const Float u = h < 8 ? x : y;
+			const Float v = h < 4 ? y : h == 12 || h == 14 ? x : z;
+			return ((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v);
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float Grad1D(const std::int32_t hash, const Float x) noexcept
+		{
+			const std::int32_t h = hash & 15;
+			const Float g = static_cast<Float>(1 + (h & 7)) * Float(0.25);
+			return ((h & 8) == 0 ? g : -g) * x;
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float Grad2D(const std::int32_t hash, const Float x, const Float y) noexcept
+		{
+			return Grad(hash, x, y, Float(0));
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float FadeDerivative(const Float t) noexcept
+		{
+			return t * t * (t * (t * 30 - 60) + 30);
+		}
+
+		// Grad() and the gradient vector it selects
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr BasicNoiseDerivative3D<Float> GradDerivative(const std::int32_t hash, const Float x, const Float y, const Float z) noexcept
+		{
+			const std::int32_t h = hash & 15;
+			const Float su = ((h & 1) == 0 ? Float(1) : Float(-1));
+			const Float sv = ((h & 2) == 0 ? Float(1) : Float(-1));
+			const bool uIsX = (h < 8);
+			const std::int32_t vAxis = (h < 4 ? 1 : h == 12 || h == 14 ? 0 : 2);
+			return{ Grad(hash, x, y, z),
+				((uIsX ? su : Float(0)) + (vAxis == 0 ? sv : Float(0))),
+				((uIsX ? Float(0) : su) + (vAxis == 1 ? sv : Float(0))),
+				(vAxis == 2 ? sv : Float(0)) };
+		}
+
+		// Lerp() of two values with gradients. t depends only on the coordinate along Axis, with derivative dt.
+		template <std::int32_t Axis, class Float>
+		[[nodiscard]]
+		inline constexpr BasicNoiseDerivative3D<Float> LerpDerivative(const BasicNoiseDerivative3D<Float>& a, const BasicNoiseDerivative3D<Float>& b, const Float t, const Float dt) noexcept
+		{
+			BasicNoiseDerivative3D<Float> result{ Lerp(a.value, b.value, t), Lerp(a.dx, b.dx, t), Lerp(a.dy, b.dy, t), Lerp(a.dz, b.dz, t) };
+			const Float d = ((b.value - a.value) * dt);
+
+			if constexpr (Axis == 0)
+			{
+				result.dx += d;
+			}
+			else if constexpr (Axis == 1)
+			{
+				result.dy += d;
+			}
+			else
+			{
+				result.dz += d;
+			}
+
+			return result;
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float Remap_01(const Float x) noexcept
+		{
+			return (x * Float(0.5) + Float(0.5));
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float Clamp_11(const Float x) noexcept
+		{
+			return std::clamp(x, Float(-1.0), Float(1.0));
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float RemapClamp_01(const Float x) noexcept
+		{
+			if (x <= Float(-1.0))
+			{
+				return Float(0.0);
+			}
+			else if (Float(1.0) <= x)
+			{
+				return Float(1.0);
+			}
+
+			return (x * Float(0.5) + Float(0.5));
+		}
+
+		// Converts a noise value to the element type of a batch destination
+		template <class Output, class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 Output ConvertOutput(const Float x) noexcept
+		{
+			static_assert(!std::is_integral_v<Output>, "Integer destinations are only supported by the _01 batch functions");
+
+			if constexpr (std::is_same_v<Output, Half>)
+			{
+				return Half{ static_cast<float>(x) };
+			}
+			else
+			{
+				return static_cast<Output>(x);
+			}
+		}
+
+		// Converts a noise value in the range [0, 1] to the element type of a batch destination.
+		// Integer destinations are clamped, scaled to [0, max] and rounded to nearest.
+		template <class Output, class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 Output ConvertOutput_01(const Float x) noexcept
+		{
+			if constexpr (std::is_integral_v<Output>)
+			{
+				static_assert((std::is_same_v<Output, std::uint8_t> || std::is_same_v<Output, std::uint16_t>),
+					"Integer destinations must be std::uint8_t or std::uint16_t");
+
+				constexpr std::uint32_t Max = std::numeric_limits<Output>::max();
+
+				if constexpr (IsFixedPoint<Float>)
+				{
+					// Scaled in the raw representation, since Max does not fit in Q16.16
+					constexpr std::int64_t One = (std::int64_t(1) << Float::fractional_bits);
+					const std::int64_t raw = std::clamp<std::int64_t>(x.raw(), 0, One);
+					return static_cast<Output>((raw * Max + (One / 2)) >> Float::fractional_bits);
+				}
+				else
+				{
+					return static_cast<Output>(std::clamp(x, Float(0.0), Float(1.0)) * Float(Max) + Float(0.5));
+				}
+			}
+			else
+			{
+				return ConvertOutput<Output>(x);
+			}
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float MaxAmplitude(const std::int32_t octaves, const Float persistence) noexcept
+		{
+			using value_type = Float;
+			value_type result = 0;
+			value_type amplitude = 1;
+
+			for (std::int32_t i = 0; i < octaves; ++i)
+			{
+				result += amplitude;
+				amplitude *= persistence;
+			}
+
+			return result;
+		}
+
+		////////////////////////////////////////////////
+		//
+		//	Batch
+		//
+
+		// Number of samples evaluated together by the batch functions
+		template <class Float>
+		inline constexpr std::size_t SimdLanes = std::max<std::size_t>(4, (SIVPERLIN_SIMD_BYTES / sizeof(Float)));
+
+		// Same as static_cast<std::int32_t>(std::floor(x)), but without a library call so that loops over it can be vectorized
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr std::int32_t FastFloor(const Float x) noexcept
+		{
+			const std::int32_t i = static_cast<std::int32_t>(x);
+			return (i - static_cast<std::int32_t>(x < static_cast<Float>(i)));
+		}
+
+		template <class Rep, std::int32_t FractionalBits>
+		[[nodiscard]]
+		inline constexpr std::int32_t FastFloor(const BasicFixedPoint<Rep, FractionalBits> x) noexcept
+		{
+			return static_cast<std::int32_t>(x);
+		}
+
+		// 2^n as a Float
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float Pow2(const std::int32_t n) noexcept
+		{
+			Float result = 1;
+
+			for (std::int32_t i = 0; i < n; ++i)
+			{
+				result *= 2;
+			}
+
+			return result;
+		}
+
+		// Subtracts a multiple of 2^30 (and so of the 256 lattice cells) from x, so that FastFloor() of the result does not overflow.
+		// x + c - c rounds x to a multiple of 2^30 without a library call. Coordinates within [-2^29, 2^29] are returned as they are.
+		// Beyond 2^(digits + 28) every value is a multiple of 2^29, so those (and infinities and NaN) become 0.
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float WrapCoordinate(const Float x) noexcept
+		{
+			constexpr std::int32_t Digits = std::numeric_limits<Float>::digits;
+			constexpr Float Round = (Pow2<Float>(Digits + 29) * Float(1.5));
+			constexpr Float Limit = Pow2<Float>(Digits + 28);
+			const Float r = (x - ((x + Round) - Round));
+			return (((-Limit < x) && (x < Limit)) ? r : Float(0));
+		}
+
+		template <class Rep, std::int32_t FractionalBits>
+		[[nodiscard]]
+		inline constexpr BasicFixedPoint<Rep, FractionalBits> WrapCoordinate(const BasicFixedPoint<Rep, FractionalBits> x) noexcept
+		{
+			return x;
+		}
+
+		// Computes the lattice cells (modulo 256) and the fractional coordinates of N samples
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void CellBlock3D(const Float* xs, const Float* ys, const Float* zs,
+			std::int32_t (&ix)[N], std::int32_t (&iy)[N], std::int32_t (&iz)[N], Float (&fx)[N], Float (&fy)[N], Float (&fz)[N]) noexcept
+		{
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = WrapCoordinate(xs[i]);
+				const Float y = WrapCoordinate(ys[i]);
+				const Float z = WrapCoordinate(zs[i]);
+				const std::int32_t x0 = FastFloor(x);
+				const std::int32_t y0 = FastFloor(y);
+				const std::int32_t z0 = FastFloor(z);
+				ix[i] = (x0 & 255);
+				iy[i] = (y0 & 255);
+				iz[i] = (z0 & 255);
+				fx[i] = (x - static_cast<Float>(x0));
+				fy[i] = (y - static_cast<Float>(y0));
+				fz[i] = (z - static_cast<Float>(z0));
+			}
+		}
+
+		// Computes the hashes of the 8 corners of N cells
+		template <std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void CornerHashes3D(const std::uint8_t* p,
+			const std::int32_t (&ix)[N], const std::int32_t (&iy)[N], const std::int32_t (&iz)[N], std::int32_t (&h)[8][N]) noexcept
+		{
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const std::int32_t A = (p[ix[i]] + iy[i]);
+				const std::int32_t B = (p[ix[i] + 1] + iy[i]);
+				const std::int32_t AA = (p[A] + iz[i]);
+				const std::int32_t AB = (p[A + 1] + iz[i]);
+				const std::int32_t BA = (p[B] + iz[i]);
+				const std::int32_t BB = (p[B + 1] + iz[i]);
+				h[0][i] = p[AA];
+				h[1][i] = p[BA];
+				h[2][i] = p[AB];
+				h[3][i] = p[BB];
+				h[4][i] = p[AA + 1];
+				h[5][i] = p[BA + 1];
+				h[6][i] = p[AB + 1];
+				h[7][i] = p[BB + 1];
+			}
+		}
+
+		// Computes the fractional coordinates and the hashes of the 8 cell corners of N samples
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void HashBlock3D(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs,
+			Float (&fx)[N], Float (&fy)[N], Float (&fz)[N], std::int32_t (&h)[8][N]) noexcept
+		{
+			std::int32_t ix[N], iy[N], iz[N];
+
+			CellBlock3D(xs, ys, zs, ix, iy, iz, fx, fy, fz);
+
+			CornerHashes3D(p, ix, iy, iz, h);
+		}
+
+		// Evaluates noise3D() for N samples. Each stage is a separate loop over the lanes so that the compiler can vectorize it.
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void NoiseBlock3D(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs, Float* out) noexcept
+		{
+			Float fx[N], fy[N], fz[N];
+			std::int32_t h[8][N];
+
+			HashBlock3D(p, xs, ys, zs, fx, fy, fz, h);
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = fx[i], y = fy[i], z = fz[i];
+				const Float u = Fade(x);
+				const Float v = Fade(y);
+				const Float w = Fade(z);
+
+				const Float p0 = Grad(h[0][i], x, y, z);
+				const Float p1 = Grad(h[1][i], x - 1, y, z);
+				const Float p2 = Grad(h[2][i], x, y - 1, z);
+				const Float p3 = Grad(h[3][i], x - 1, y - 1, z);
+				const Float p4 = Grad(h[4][i], x, y, z - 1);
+				const Float p5 = Grad(h[5][i], x - 1, y, z - 1);
+				const Float p6 = Grad(h[6][i], x, y - 1, z - 1);
+				const Float p7 = Grad(h[7][i], x - 1, y - 1, z - 1);
+
+				const Float q0 = Lerp(p0, p1, u);
+				const Float q1 = Lerp(p2, p3, u);
+				const Float q2 = Lerp(p4, p5, u);
+				const Float q3 = Lerp(p6, p7, u);
+
+				const Float r0 = Lerp(q0, q1, v);
+				const Float r1 = Lerp(q2, q3, v);
+
+				out[i] = Lerp(r0, r1, w);
+			}
+		}
+
+		// Computes the lattice cells (modulo 256) and the fractional coordinates of N samples for the NoiseKernel::Dedicated noise2D()
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void CellBlock2D(const Float* xs, const Float* ys,
+			std::int32_t (&ix)[N], std::int32_t (&iy)[N], Float (&fx)[N], Float (&fy)[N]) noexcept
+		{
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = WrapCoordinate(xs[i]);
+				const Float y = WrapCoordinate(ys[i]);
+				const std::int32_t x0 = FastFloor(x);
+				const std::int32_t y0 = FastFloor(y);
+				ix[i] = (x0 & 255);
+				iy[i] = (y0 & 255);
+				fx[i] = (x - static_cast<Float>(x0));
+				fy[i] = (y - static_cast<Float>(y0));
+			}
+		}
+
+		// Computes the hashes of the 4 corners of N cells for the NoiseKernel::Dedicated noise2D()
+		template <std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void CornerHashes2D(const std::uint8_t* p, const std::int32_t (&ix)[N], const std::int32_t (&iy)[N], std::int32_t (&h)[4][N]) noexcept
+		{
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const std::int32_t A = (p[ix[i]] + iy[i]);
+				const std::int32_t B = (p[ix[i] + 1] + iy[i]);
+				h[0][i] = p[A];
+				h[1][i] = p[B];
+				h[2][i] = p[A + 1];
+				h[3][i] = p[B + 1];
+			}
+		}
+
+		// Computes the fractional coordinates and the hashes of the 4 cell corners of N samples for the NoiseKernel::Dedicated noise2D()
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void HashBlock2D(const std::uint8_t* p, const Float* xs, const Float* ys,
+			Float (&fx)[N], Float (&fy)[N], std::int32_t (&h)[4][N]) noexcept
+		{
+			std::int32_t ix[N], iy[N];
+
+			CellBlock2D(xs, ys, ix, iy, fx, fy);
+
+			CornerHashes2D(p, ix, iy, h);
+		}
+
+		// Evaluates the NoiseKernel::Dedicated noise2D() for N samples
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void NoiseBlock2D(const std::uint8_t* p, const Float* xs, const Float* ys, Float* out) noexcept
+		{
+			Float fx[N], fy[N];
+			std::int32_t h[4][N];
+
+			HashBlock2D(p, xs, ys, fx, fy, h);
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = fx[i], y = fy[i];
+				const Float u = Fade(x);
+				const Float v = Fade(y);
+
+				const Float p0 = Grad2D(h[0][i], x, y);
+				const Float p1 = Grad2D(h[1][i], x - 1, y);
+				const Float p2 = Grad2D(h[2][i], x, y - 1);
+				const Float p3 = Grad2D(h[3][i], x - 1, y - 1);
+
+				out[i] = Lerp(Lerp(p0, p1, u), Lerp(p2, p3, u), v);
+			}
+		}
+
+		// Evaluates the NoiseKernel::Dedicated noise1D() for N samples
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void NoiseBlock1D(const std::uint8_t* p, const Float* xs, Float* out) noexcept
+		{
+			std::int32_t ix[N];
+			Float fx[N];
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = WrapCoordinate(xs[i]);
+				const std::int32_t x0 = FastFloor(x);
+				ix[i] = (x0 & 255);
+				fx[i] = (x - static_cast<Float>(x0));
+			}
+
+			std::int32_t h[2][N];
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				h[0][i] = p[ix[i]];
+				h[1][i] = p[ix[i] + 1];
+			}
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = fx[i];
+				out[i] = Lerp(Grad1D(h[0][i], x), Grad1D(h[1][i], x - 1), Fade(x));
+			}
+		}
+
+		///////////////////////////////////////
+		//
+		//	NoiseKernel::Simplex
+		//
+		//	noise1D() sums the radial falloff (1 - d^2)^4 of the 2 nearest lattice points.
+		//	noise2D() sums the 3 corners of the triangle of a skewed lattice with the falloff (1/2 - d^2)^4.
+		//	noise3D() sums the 2 nearest points of each of the 2 interleaved cubic lattices of a body-centered cubic lattice
+		//	with the falloff (1/2 - d^2)^4, in the orientation of OpenSimplex2. The input is rotated so that the lattice diagonal points along (1, 1, 1).
+		//	These 4 points include every lattice point within sqrt(1/2), so the result is continuous. The radius of OpenSimplex2 (sqrt(3/5)) would leave small steps where the points change.
+		//	All of them use the gradients of Grad1D() and Grad() with the hashes of the permutation table, like the other kernels.
+		//
+
+		// (sqrt(3) - 1) / 2 and (1 / sqrt(3) - 1) / 2
+		inline constexpr double SimplexSkew2D = 0.36602540378443864676;
+
+		inline constexpr double SimplexUnskew2D = -0.21132486540518711775;
+
+		// Scale factors that bring the largest possible values (with the gradients of Grad1D() and Grad()) just within [-1, 1]
+		inline constexpr double SimplexScale1D = (128.0 / 81.0);
+
+		inline constexpr double SimplexScale2D = 70.14;
+
+		inline constexpr double SimplexScale3D = 76.87;
+
+		// The gradient vectors selected by Grad() for each hash & 15
+		template <class Float>
+		inline constexpr Float SimplexGradients[16][3] =
+		{
+			{ Float(1), Float(1), Float(0) }, { Float(-1), Float(1), Float(0) }, { Float(1), Float(-1), Float(0) }, { Float(-1), Float(-1), Float(0) },
+			{ Float(1), Float(0), Float(1) }, { Float(-1), Float(0), Float(1) }, { Float(1), Float(0), Float(-1) }, { Float(-1), Float(0), Float(-1) },
+			{ Float(0), Float(1), Float(1) }, { Float(0), Float(-1), Float(1) }, { Float(0), Float(1), Float(-1) }, { Float(0), Float(-1), Float(-1) },
+			{ Float(1), Float(1), Float(0) }, { Float(0), Float(-1), Float(1) }, { Float(-1), Float(1), Float(0) }, { Float(0), Float(-1), Float(-1) },
+		};
+
+		// Same as Grad(), but with a table lookup instead of branches on the hash.
+		// The lattice points of NoiseKernel::Simplex change within a cell, so those branches would be mispredicted.
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float SimplexGrad(const std::int32_t hash, const Float x, const Float y, const Float z) noexcept
+		{
+			const Float* g = SimplexGradients<Float>[hash & 15];
+			return (g[0] * x + g[1] * y + g[2] * z);
+		}
+
+		// (r^2 - d^2)^4 if d^2 < r^2, otherwise 0
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float SimplexFalloff(const Float a) noexcept
+		{
+			const Float b = ((Float(0) < a) ? a : Float(0));
+			const Float b2 = (b * b);
+			return (b2 * b2);
+		}
+
+		// Evaluates the NoiseKernel::Simplex noise1D() for N samples
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void SimplexBlock1D(const std::uint8_t* p, const Float* xs, Float* out) noexcept
+		{
+			std::int32_t ix[N];
+			Float fx[N];
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = WrapCoordinate(xs[i]);
+				const std::int32_t x0 = FastFloor(x);
+				ix[i] = (x0 & 255);
+				fx[i] = (x - static_cast<Float>(x0));
+			}
+
+			std::int32_t h[2][N];
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				h[0][i] = p[ix[i]];
+				h[1][i] = p[ix[i] + 1];
+			}
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x0 = fx[i];
+				const Float x1 = (x0 - 1);
+				const Float n0 = (SimplexFalloff(1 - x0 * x0) * Grad1D(h[0][i], x0));
+				const Float n1 = (SimplexFalloff(1 - x1 * x1) * Grad1D(h[1][i], x1));
+				out[i] = ((n0 + n1) * static_cast<Float>(SimplexScale1D));
+			}
+		}
+
+		// Computes the 3 triangle corners of N samples for the NoiseKernel::Simplex noise2D(): their hashes and the offsets (dx, dy) of the sample from them
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void SimplexCorners2D(const std::uint8_t* p, const Float* xs, const Float* ys,
+			std::int32_t (&h)[3][N], Float (&dx)[3][N], Float (&dy)[3][N]) noexcept
+		{
+			const Float skew = static_cast<Float>(SimplexSkew2D);
+			const Float unskew = static_cast<Float>(SimplexUnskew2D);
+			std::int32_t ix[N], iy[N], cx[N];
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float s = ((xs[i] + ys[i]) * skew);
+				const Float sx = WrapCoordinate(xs[i] + s);
+				const Float sy = WrapCoordinate(ys[i] + s);
+				const std::int32_t x0 = FastFloor(sx);
+				const std::int32_t y0 = FastFloor(sy);
+				const Float fx = (sx - static_cast<Float>(x0));
+				const Float fy = (sy - static_cast<Float>(y0));
+				const Float t = ((fx + fy) * unskew);
+
+				// The third corner is (1, 0) below the diagonal of the skewed cell and (0, 1) above it.
+				// It is selected arithmetically, since the side changes too often within a cell for a branch to be predicted.
+				const std::int32_t lower = static_cast<std::int32_t>(fy <= fx);
+				const Float dx0 = (fx + t);
+				const Float dy0 = (fy + t);
+
+				ix[i] = (x0 & 255);
+				iy[i] = (y0 & 255);
+				cx[i] = lower;
+				dx[0][i] = dx0;
+				dy[0][i] = dy0;
+				dx[1][i] = (dx0 - (1 + 2 * unskew));
+				dy[1][i] = (dy0 - (1 + 2 * unskew));
+				dx[2][i] = (dx0 - (static_cast<Float>(lower) + unskew));
+				dy[2][i] = (dy0 - (static_cast<Float>(1 - lower) + unskew));
+			}
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				h[0][i] = p[p[ix[i]] + iy[i]];
+				h[1][i] = p[p[ix[i] + 1] + iy[i] + 1];
+				h[2][i] = p[p[ix[i] + cx[i]] + iy[i] + (1 - cx[i])];
+			}
+		}
+
+		// Evaluates the NoiseKernel::Simplex noise2D() for N samples
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void SimplexBlock2D(const std::uint8_t* p, const Float* xs, const Float* ys, Float* out) noexcept
+		{
+			std::int32_t h[3][N];
+			Float dx[3][N], dy[3][N];
+
+			SimplexCorners2D(p, xs, ys, h, dx, dy);
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				Float value = 0;
+
+				for (std::size_t k = 0; k < 3; ++k)
+				{
+					const Float x = dx[k][i], y = dy[k][i];
+					value += (SimplexFalloff(Float(0.5) - x * x - y * y) * SimplexGrad(h[k][i], x, y, Float(0)));
+				}
+
+				out[i] = (value * static_cast<Float>(SimplexScale2D));
+			}
+		}
+
+		// Computes the 4 lattice points of N samples for the NoiseKernel::Simplex noise3D(): their hashes and the offsets (dx, dy, dz) of the rotated sample from them.
+		// Points of the second cubic lattice are offset by (1/2, 1/2, 1/2) and hashed 128 cells away, so that they do not share hashes with nearby points of the first one.
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void SimplexCorners3D(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs,
+			std::int32_t (&h)[4][N], Float (&dx)[4][N], Float (&dy)[4][N], Float (&dz)[4][N]) noexcept
+		{
+			std::int32_t ix[4][N], iy[4][N], iz[4][N];
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float r = ((xs[i] + ys[i] + zs[i]) * (Float(2) / Float(3)));
+				const Float xr = WrapCoordinate(r - xs[i]);
+				const Float yr = WrapCoordinate(r - ys[i]);
+				const Float zr = WrapCoordinate(r - zs[i]);
+
+				for (std::size_t lattice = 0; lattice < 2; ++lattice)
+				{
+					const Float half = ((lattice == 0) ? Float(0.5) : Float(0));
+					const std::int32_t x0 = FastFloor(xr + half);
+					const std::int32_t y0 = FastFloor(yr + half);
+					const std::int32_t z0 = FastFloor(zr + half);
+					const std::int32_t offset = ((lattice == 0) ? 0 : 128);
+					const Float x = (xr - static_cast<Float>(x0) - (Float(0.5) - half));
+					const Float y = (yr - static_cast<Float>(y0) - (Float(0.5) - half));
+					const Float z = (zr - static_cast<Float>(z0) - (Float(0.5) - half));
+
+					// The nearest point, and the next one along the axis with the largest offset.
+					// Like SimplexCorners2D(), the axis and the direction are selected arithmetically.
+					const Float xx = (x * x), yy = (y * y), zz = (z * z);
+					const std::int32_t alongX = (static_cast<std::int32_t>(yy <= xx) & static_cast<std::int32_t>(zz <= xx));
+					const std::int32_t alongY = ((1 - alongX) & static_cast<std::int32_t>(zz <= yy));
+					const std::int32_t alongZ = (1 - alongX - alongY);
+					const std::int32_t sx = (alongX * (1 - 2 * static_cast<std::int32_t>(x < 0)));
+					const std::int32_t sy = (alongY * (1 - 2 * static_cast<std::int32_t>(y < 0)));
+					const std::int32_t sz = (alongZ * (1 - 2 * static_cast<std::int32_t>(z < 0)));
+					const std::size_t k = (lattice * 2);
+
+					ix[k][i] = ((x0 + offset) & 255);
+					iy[k][i] = (y0 & 255);
+					iz[k][i] = (z0 & 255);
+					dx[k][i] = x;
+					dy[k][i] = y;
+					dz[k][i] = z;
+
+					ix[k + 1][i] = ((x0 + offset + sx) & 255);
+					iy[k + 1][i] = ((y0 + sy) & 255);
+					iz[k + 1][i] = ((z0 + sz) & 255);
+					dx[k + 1][i] = (x - static_cast<Float>(sx));
+					dy[k + 1][i] = (y - static_cast<Float>(sy));
+					dz[k + 1][i] = (z - static_cast<Float>(sz));
+				}
+			}
+
+			for (std::size_t k = 0; k < 4; ++k)
+			{
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					h[k][i] = p[p[p[ix[k][i]] + iy[k][i]] + iz[k][i]];
+				}
+			}
+		}
+
+		// Evaluates the NoiseKernel::Simplex noise3D() for N samples
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void SimplexBlock3D(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs, Float* out) noexcept
+		{
+			std::int32_t h[4][N];
+			Float dx[4][N], dy[4][N], dz[4][N];
+
+			SimplexCorners3D(p, xs, ys, zs, h, dx, dy, dz);
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				Float value = 0;
+
+				for (std::size_t k = 0; k < 4; ++k)
+				{
+					const Float x = dx[k][i], y = dy[k][i], z = dz[k][i];
+					value += (SimplexFalloff(Float(0.5) - x * x - y * y - z * z) * SimplexGrad(h[k][i], x, y, z));
+				}
+
+				out[i] = (value * static_cast<Float>(SimplexScale3D));
+			}
+		}
+
+		// Evaluates noise3D() and its gradient for N samples
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void NoiseDerivativeBlock3D(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs, BasicNoiseDerivative3D<Float>* out) noexcept
+		{
+			Float fx[N], fy[N], fz[N];
+			std::int32_t h[8][N];
+
+			HashBlock3D(p, xs, ys, zs, fx, fy, fz, h);
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = fx[i], y = fy[i], z = fz[i];
+				const Float u = Fade(x), du = FadeDerivative(x);
+				const Float v = Fade(y), dv = FadeDerivative(y);
+				const Float w = Fade(z), dw = FadeDerivative(z);
+
+				const auto p0 = GradDerivative(h[0][i], x, y, z);
+				const auto p1 = GradDerivative(h[1][i], x - 1, y, z);
+				const auto p2 = GradDerivative(h[2][i], x, y - 1, z);
+				const auto p3 = GradDerivative(h[3][i], x - 1, y - 1, z);
+				const auto p4 = GradDerivative(h[4][i], x, y, z - 1);
+				const auto p5 = GradDerivative(h[5][i], x - 1, y, z - 1);
+				const auto p6 = GradDerivative(h[6][i], x, y - 1, z - 1);
+				const auto p7 = GradDerivative(h[7][i], x - 1, y - 1, z - 1);
+
+				const auto q0 = LerpDerivative<0>(p0, p1, u, du);
+				const auto q1 = LerpDerivative<0>(p2, p3, u, du);
+				const auto q2 = LerpDerivative<0>(p4, p5, u, du);
+				const auto q3 = LerpDerivative<0>(p6, p7, u, du);
+
+				const auto r0 = LerpDerivative<1>(q0, q1, v, dv);
+				const auto r1 = LerpDerivative<1>(q2, q3, v, dv);
+
+				out[i] = LerpDerivative<2>(r0, r1, w, dw);
+			}
+		}
+
+		// Evaluates the NoiseKernel::Dedicated noise2D() and its gradient for N samples (dz is always 0)
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void NoiseDerivativeBlock2D(const std::uint8_t* p, const Float* xs, const Float* ys, BasicNoiseDerivative3D<Float>* out) noexcept
+		{
+			Float fx[N], fy[N];
+			std::int32_t h[4][N];
+
+			HashBlock2D(p, xs, ys, fx, fy, h);
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = fx[i], y = fy[i];
+				const Float u = Fade(x), du = FadeDerivative(x);
+				const Float v = Fade(y), dv = FadeDerivative(y);
+
+				const auto p0 = GradDerivative(h[0][i], x, y, Float(0));
+				const auto p1 = GradDerivative(h[1][i], x - 1, y, Float(0));
+				const auto p2 = GradDerivative(h[2][i], x, y - 1, Float(0));
+				const auto p3 = GradDerivative(h[3][i], x - 1, y - 1, Float(0));
+
+				const auto q0 = LerpDerivative<0>(p0, p1, u, du);
+				const auto q1 = LerpDerivative<0>(p2, p3, u, du);
+
+				out[i] = LerpDerivative<1>(q0, q1, v, dv);
+				out[i].dz = 0;
+			}
+		}
+
+		// Adds falloff(a) * Grad() of one point and its gradient with respect to the offset (x, y, z): the falloff contributes -8 a^3 * Grad() * (x, y, z)
+		template <class Float>
+		inline constexpr void AddSimplexPoint(BasicNoiseDerivative3D<Float>& sum, const std::int32_t hash, const Float a, const Float x, const Float y, const Float z) noexcept
+		{
+			const Float b = ((Float(0) < a) ? a : Float(0));
+			const Float b3 = (b * b * b);
+			const Float b4 = (b3 * b);
+			const Float* g = SimplexGradients<Float>[hash & 15];
+			const Float value = (g[0] * x + g[1] * y + g[2] * z);
+			const Float d = (Float(-8) * b3 * value);
+
+			sum.value += (b4 * value);
+			sum.dx += (b4 * g[0] + d * x);
+			sum.dy += (b4 * g[1] + d * y);
+			sum.dz += (b4 * g[2] + d * z);
+		}
+
+		// Evaluates the NoiseKernel::Simplex noise2D() and its gradient for N samples (dz is always 0).
+		// The offsets from the corners are in the input coordinates, so their gradient is the gradient of the noise.
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void SimplexDerivativeBlock2D(const std::uint8_t* p, const Float* xs, const Float* ys, BasicNoiseDerivative3D<Float>* out) noexcept
+		{
+			std::int32_t h[3][N];
+			Float dx[3][N], dy[3][N];
+
+			SimplexCorners2D(p, xs, ys, h, dx, dy);
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				BasicNoiseDerivative3D<Float> sum;
+
+				for (std::size_t k = 0; k < 3; ++k)
+				{
+					const Float x = dx[k][i], y = dy[k][i];
+					AddSimplexPoint(sum, h[k][i], (Float(0.5) - x * x - y * y), x, y, Float(0));
+				}
+
+				const Float scale = static_cast<Float>(SimplexScale2D);
+				out[i] = { (sum.value * scale), (sum.dx * scale), (sum.dy * scale), Float(0) };
+			}
+		}
+
+		// Evaluates the NoiseKernel::Simplex noise3D() and its gradient for N samples.
+		// The rotation (x, y, z) -> 2/3 (x + y + z) - (x, y, z) is symmetric, so the gradient in the input coordinates is the same rotation of the lattice gradient.
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void SimplexDerivativeBlock3D(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs, BasicNoiseDerivative3D<Float>* out) noexcept
+		{
+			std::int32_t h[4][N];
+			Float dx[4][N], dy[4][N], dz[4][N];
+
+			SimplexCorners3D(p, xs, ys, zs, h, dx, dy, dz);
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				BasicNoiseDerivative3D<Float> sum;
+
+				for (std::size_t k = 0; k < 4; ++k)
+				{
+					const Float x = dx[k][i], y = dy[k][i], z = dz[k][i];
+					AddSimplexPoint(sum, h[k][i], (Float(0.5) - x * x - y * y - z * z), x, y, z);
+				}
+
+				const Float scale = static_cast<Float>(SimplexScale3D);
+				const Float r = ((sum.dx + sum.dy + sum.dz) * (Float(2) / Float(3)));
+				out[i] = { (sum.value * scale), ((r - sum.dx) * scale), ((r - sum.dy) * scale), ((r - sum.dz) * scale) };
+			}
+		}
+
+		// Evaluates noiseND() and its gradient of the given kernel for N samples (Dimension is 2 or 3)
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void NoiseDerivativeBlock(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs, BasicNoiseDerivative3D<Float>* out) noexcept
+		{
+			static_assert((Dimension == 2) || (Dimension == 3));
+
+			if constexpr ((Dimension == 2) && (Kernel == NoiseKernel::Simplex))
+			{
+				SimplexDerivativeBlock2D<Float, N>(p, xs, ys, out);
+			}
+			else if constexpr (Kernel == NoiseKernel::Simplex)
+			{
+				SimplexDerivativeBlock3D<Float, N>(p, xs, ys, zs, out);
+			}
+			else if constexpr ((Dimension == 2) && (Kernel == NoiseKernel::Dedicated))
+			{
+				NoiseDerivativeBlock2D<Float, N>(p, xs, ys, out);
+			}
+			else
+			{
+				NoiseDerivativeBlock3D<Float, N>(p, xs, ys, zs, out);
+			}
+		}
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr BasicNoiseDerivative2D<Float> ToDerivative2D(const BasicNoiseDerivative3D<Float>& d) noexcept
+		{
+			return{ d.value, d.dx, d.dy };
+		}
+
+		// Adds octave noise and its gradient: the gradient of amplitude * noise(frequency * p) is amplitude * frequency * gradient
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 BasicNoiseDerivative3D<Float> OctaveDerivative(const std::uint8_t* p, Float x, Float y, Float z, const std::int32_t octaves, const Float persistence) noexcept
+		{
+			BasicNoiseDerivative3D<Float> result;
+			Float amplitude = 1;
+			Float frequency = 1;
+
+			for (std::int32_t i = 0; i < octaves; ++i)
+			{
+				BasicNoiseDerivative3D<Float> n;
+				NoiseDerivativeBlock<Dimension, Kernel, Float, 1>(p, &x, &y, &z, &n);
+
+				const Float scale = (amplitude * frequency);
+				result.value += (n.value * amplitude);
+				result.dx += (n.dx * scale);
+				result.dy += (n.dy * scale);
+				result.dz += (n.dz * scale);
+
+				x *= 2;
+				y *= 2;
+				z *= ((Dimension == 3) ? 2 : 1);
+				amplitude *= persistence;
+				frequency *= 2;
+			}
+
+			return result;
+		}
+
+		// Evaluates noiseND() of the given kernel for N samples. Coordinates beyond the dimension are passed to noise3D() as they are.
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void NoiseBlock(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs, Float* out) noexcept
+		{
+			if constexpr ((Dimension == 1) && (Kernel == NoiseKernel::Simplex))
+			{
+				SimplexBlock1D<Float, N>(p, xs, out);
+			}
+			else if constexpr ((Dimension == 2) && (Kernel == NoiseKernel::Simplex))
+			{
+				SimplexBlock2D<Float, N>(p, xs, ys, out);
+			}
+			else if constexpr (Kernel == NoiseKernel::Simplex)
+			{
+				SimplexBlock3D<Float, N>(p, xs, ys, zs, out);
+			}
+			else if constexpr ((Dimension == 1) && (Kernel == NoiseKernel::Dedicated))
+			{
+				NoiseBlock1D<Float, N>(p, xs, out);
+			}
+			else if constexpr ((Dimension == 2) && (Kernel == NoiseKernel::Dedicated))
+			{
+				NoiseBlock2D<Float, N>(p, xs, ys, out);
+			}
+			else
+			{
+				NoiseBlock3D<Float, N>(p, xs, ys, zs, out);
+			}
+		}
+
+		// Evaluates noiseND() of the given kernel for N samples with each of K permutation tables.
+		// The cells, fractional coordinates and fade curves are shared by all tables.
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, std::size_t N, std::size_t K>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void NoiseBankBlock(const PermutationTable* tables, const Float* xs, const Float* ys, const Float* zs, Float (&out)[K][N]) noexcept
+		{
+			static_assert((Dimension == 2) || (Dimension == 3));
+
+			if constexpr (Kernel == NoiseKernel::Simplex)
+			{
+				for (std::size_t k = 0; k < K; ++k)
+				{
+					NoiseBlock<Dimension, Kernel, Float, N>(tables[k].data(), xs, ys, zs, out[k]);
+				}
+			}
+			else if constexpr ((Dimension == 2) && (Kernel == NoiseKernel::Dedicated))
+			{
+				std::int32_t ix[N], iy[N];
+				Float fx[N], fy[N], u[N], v[N];
+
+				CellBlock2D(xs, ys, ix, iy, fx, fy);
+
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					u[i] = Fade(fx[i]);
+					v[i] = Fade(fy[i]);
+				}
+
+				for (std::size_t k = 0; k < K; ++k)
+				{
+					std::int32_t h[4][N];
+
+					CornerHashes2D(tables[k].data(), ix, iy, h);
+
+					for (std::size_t i = 0; i < N; ++i)
+					{
+						const Float x = fx[i], y = fy[i];
+
+						const Float p0 = Grad2D(h[0][i], x, y);
+						const Float p1 = Grad2D(h[1][i], x - 1, y);
+						const Float p2 = Grad2D(h[2][i], x, y - 1);
+						const Float p3 = Grad2D(h[3][i], x - 1, y - 1);
+
+						out[k][i] = Lerp(Lerp(p0, p1, u[i]), Lerp(p2, p3, u[i]), v[i]);
+					}
+				}
+			}
+			else
+			{
+				std::int32_t ix[N], iy[N], iz[N];
+				Float fx[N], fy[N], fz[N], u[N], v[N], w[N];
+
+				CellBlock3D(xs, ys, zs, ix, iy, iz, fx, fy, fz);
+
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					u[i] = Fade(fx[i]);
+					v[i] = Fade(fy[i]);
+					w[i] = Fade(fz[i]);
+				}
+
+				for (std::size_t k = 0; k < K; ++k)
+				{
+					std::int32_t h[8][N];
+
+					CornerHashes3D(tables[k].data(), ix, iy, iz, h);
+
+					for (std::size_t i = 0; i < N; ++i)
+					{
+						const Float x = fx[i], y = fy[i], z = fz[i];
+
+						const Float p0 = Grad(h[0][i], x, y, z);
+						const Float p1 = Grad(h[1][i], x - 1, y, z);
+						const Float p2 = Grad(h[2][i], x, y - 1, z);
+						const Float p3 = Grad(h[3][i], x - 1, y - 1, z);
+						const Float p4 = Grad(h[4][i], x, y, z - 1);
+						const Float p5 = Grad(h[5][i], x - 1, y, z - 1);
+						const Float p6 = Grad(h[6][i], x, y - 1, z - 1);
+						const Float p7 = Grad(h[7][i], x - 1, y - 1, z - 1);
+
+						const Float q0 = Lerp(p0, p1, u[i]);
+						const Float q1 = Lerp(p2, p3, u[i]);
+						const Float q2 = Lerp(p4, p5, u[i]);
+						const Float q3 = Lerp(p6, p7, u[i]);
+
+						const Float r0 = Lerp(q0, q1, v[i]);
+						const Float r1 = Lerp(q2, q3, v[i]);
+
+						out[k][i] = Lerp(r0, r1, w[i]);
+					}
+				}
+			}
+		}
+
+		// Octave noise of N samples with each of K permutation tables. The octaves are summed in the same order as octaveND().
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, std::size_t N, std::size_t K>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void OctaveBankBlock(const PermutationTable* tables, Float* xs, Float* ys, Float* zs,
+			const std::int32_t octaves, const Float persistence, Float (&result)[K][N]) noexcept
+		{
+			Float n[K][N];
+			Float amplitude = 1;
+
+			for (std::size_t k = 0; k < K; ++k)
+			{
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					result[k][i] = 0;
+				}
+			}
+
+			for (std::int32_t o = 0; o < octaves; ++o)
+			{
+				NoiseBankBlock<Dimension, Kernel, Float, N, K>(tables, xs, ys, zs, n);
+
+				for (std::size_t k = 0; k < K; ++k)
+				{
+					for (std::size_t i = 0; i < N; ++i)
+					{
+						result[k][i] += (n[k][i] * amplitude);
+					}
+				}
+
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					xs[i] *= 2;
+					ys[i] *= 2;
+					zs[i] *= ((Dimension == 3) ? 2 : 1);
+				}
+
+				amplitude *= persistence;
+			}
+		}
+
+		template <class Float>
+		struct OctaveState
+		{
+			Float x, y, z;
+
+			Float amplitude;
+
+			Float result;
+
+			std::int32_t remaining;
+		};
+
+		// Adds the next octaves of a single sample to the result, evaluating M octaves together in SIMD lanes while at least M remain.
+		// The octaves are still summed in order, so the result is the same as adding them one by one.
+		template <std::int32_t Dimension, NoiseKernel Kernel, std::size_t M, class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 OctaveState<Float> AccumulateOctaves(const std::uint8_t* p, OctaveState<Float> state, const Float persistence) noexcept
+		{
+			while (static_cast<std::int32_t>(M) <= state.remaining)
+			{
+				Float xs[M], ys[M], zs[M], amplitudes[M], n[M];
+
+				for (std::size_t i = 0; i < M; ++i)
+				{
+					xs[i] = state.x;
+					ys[i] = state.y;
+					zs[i] = state.z;
+					amplitudes[i] = state.amplitude;
+
+					state.x *= 2;
+
+					if constexpr (2 <= Dimension)
+					{
+						state.y *= 2;
+					}
+
+					if constexpr (3 <= Dimension)
+					{
+						state.z *= 2;
+					}
+
+					state.amplitude *= persistence;
+				}
+
+				NoiseBlock<Dimension, Kernel, Float, M>(p, xs, ys, zs, n);
+
+				for (std::size_t i = 0; i < M; ++i)
+				{
+					state.result += (n[i] * amplitudes[i]);
+				}
+
+				state.remaining -= static_cast<std::int32_t>(M);
+			}
+
+			// Partial blocks are slower than the scalar kernel, so the remaining octaves are evaluated one at a time
+			if constexpr (1 < M)
+			{
+				return AccumulateOctaves<Dimension, Kernel, 1>(p, state, persistence);
+			}
+			else
+			{
+				return state;
+			}
+		}
+
+		// Number of octaves of a single sample evaluated together.
+		// NoiseKernel::Compatible octave1D() and octave2D() evaluate one octave at a time, like v3.0 with its constant y and z.
+		// Compilers contract blocks of those octaves into FMA differently, so the result would no longer be the same as v3.0.
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float>
+		inline constexpr std::size_t OctaveLanes = (((Kernel == NoiseKernel::Compatible) && (Dimension < 3)) ? 1 : SimdLanes<Float>);
+
+		// Octave noise of a single sample. Blocks of octaves are evaluated together instead of through separate noiseND() calls,
+		// with the frequency and amplitude schedule of each block computed up front.
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 Float Octave(const std::uint8_t* p, const Float x, const Float y, const Float z, const std::int32_t octaves, const Float persistence) noexcept
+		{
+			const OctaveState<Float> state{ x, y, z, Float(1), Float(0), octaves };
+
+			return AccumulateOctaves<Dimension, Kernel, OctaveLanes<Dimension, Kernel, Float>>(p, state, persistence).result;
+		}
+
+		template <NoiseKernel Kernel, class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 Float Octave1D(const std::uint8_t* p, const Float x, const std::int32_t octaves, const Float persistence) noexcept
+		{
+			return Octave<1, Kernel>(p, x, static_cast<Float>(SIVPERLIN_DEFAULT_Y), static_cast<Float>(SIVPERLIN_DEFAULT_Z), octaves, persistence);
+		}
+
+		template <NoiseKernel Kernel, class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 Float Octave2D(const std::uint8_t* p, const Float x, const Float y, const std::int32_t octaves, const Float persistence) noexcept
+		{
+			return Octave<2, Kernel>(p, x, y, static_cast<Float>(SIVPERLIN_DEFAULT_Z), octaves, persistence);
+		}
+
+		template <NoiseKernel Kernel, class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 Float Octave3D(const std::uint8_t* p, const Float x, const Float y, const Float z, const std::int32_t octaves, const Float persistence) noexcept
+		{
+			return Octave<3, Kernel>(p, x, y, z, octaves, persistence);
+		}
+
+		// Calls block(xs, ys, zs, index, count) for each run of N consecutive samples of a row.
+		// index is the position of the first sample in dst and count (<= N) the number of valid lanes.
+		// With NoiseKernel::Compatible, 2D grids use the constant SIVPERLIN_DEFAULT_Z like noise2D().
+		template <std::int32_t Dimension, std::size_t N, class Float, class Block>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void ForEachBlock(const BasicNoiseGrid<Float>& grid, Block block) noexcept
+		{
+			constexpr bool is3D = (Dimension == 3);
+			const std::size_t depth = (is3D ? grid.depth : 1);
+
+			for (std::size_t k = 0; k < depth; ++k)
+			{
+				const Float z = (is3D ? (grid.z + static_cast<Float>(grid.offsetZ + static_cast<std::int64_t>(k)) * grid.stepZ) : static_cast<Float>(SIVPERLIN_DEFAULT_Z));
+
+				for (std::size_t j = 0; j < grid.height; ++j)
+				{
+					const Float y = (grid.y + static_cast<Float>(grid.offsetY + static_cast<std::int64_t>(j)) * grid.stepY);
+					const std::size_t row = ((k * grid.height + j) * grid.width);
+
+					for (std::size_t i0 = 0; i0 < grid.width; i0 += N)
+					{
+						Float xs[N], ys[N], zs[N];
+
+						for (std::size_t i = 0; i < N; ++i)
+						{
+							xs[i] = (grid.x + static_cast<Float>(grid.offsetX + static_cast<std::int64_t>(i0 + i)) * grid.stepX);
+							ys[i] = y;
+							zs[i] = z;
+						}
+
+						block(xs, ys, zs, (row + i0), std::min(N, (grid.width - i0)));
+					}
+				}
+			}
+		}
+
+		// Lattice cell (modulo 256), fractional coordinate and fade weight of one coordinate
+		template <class Float>
+		struct AxisCell
+		{
+			std::int32_t cell;
+
+			Float f;
+
+			Float fade;
+		};
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr AxisCell<Float> MakeAxisCell(const Float x) noexcept
+		{
+			const Float w = WrapCoordinate(x);
+			const std::int32_t x0 = FastFloor(w);
+			const Float f = (w - static_cast<Float>(x0));
+			return{ (x0 & 255), f, Fade(f) };
+		}
+
+		// Grad(hash, x, y, z) of one cell corner as a function of x for fixed y and z: s * x + c, or c if s is 0
+		template <class Float>
+		struct GradX
+		{
+			Float s;
+
+			Float c;
+		};
+
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr GradX<Float> MakeGradX(const std::int32_t hash, const Float y, const Float z) noexcept
+		{
+			const std::int32_t h = hash & 15;
+
+			if (h < 8)
+			{
+				const Float v = (h < 4 ? y : z);
+				return{ ((h & 1) == 0 ? Float(1) : Float(-1)), ((h & 2) == 0 ? v : -v) };
+			}
+			else if (h == 12 || h == 14)
+			{
+				return{ ((h & 2) == 0 ? Float(1) : Float(-1)), ((h & 1) == 0 ? y : -y) };
+			}
+			else
+			{
+				return{ Float(0), (((h & 1) == 0 ? y : -y) + ((h & 2) == 0 ? z : -z)) };
+			}
+		}
+
+		// Same as Grad(hash, x, y, z). Floating-point addition is commutative, so s * x + c rounds like the sum in Grad().
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float EvalGradX(const GradX<Float>& g, const Float x) noexcept
+		{
+			return ((g.s == Float(0)) ? g.c : (g.s * x + g.c));
+		}
+
+		// Whether an octave with the given x spacing of samples is evaluated cell by cell
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr bool IsCellCoherent(const Float spacing) noexcept
+		{
+			return (((spacing < 0) ? -spacing : spacing) * static_cast<Float>(SIVPERLIN_CELL_RUN_SAMPLES) <= 1);
+		}
+
+		// Adds amplitude * (noise) of count samples of a row to result. y and z are the same for all samples of the row.
+		// Consecutive samples with the same cell share the Corners corner hashes, given by cornerHashes(first sample, h),
+		// and their gradients are reduced to GradX once per cell, so each sample only evaluates the Corners linear terms and the blend.
+		// Corners is 8 for noise3D() and 4 for the NoiseKernel::Dedicated noise2D(). The result is the same as NoiseBlock().
+		template <std::size_t Corners, class Float, class CornerHashes>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void AccumulateCellRuns(const std::int32_t* cells, const Float* fx, const Float* fu, const std::size_t count,
+			const AxisCell<Float>& cy, const AxisCell<Float>& cz, const Float amplitude, Float* result, CornerHashes cornerHashes) noexcept
+		{
+			const Float y = cy.f, z = cz.f;
+			const Float v = cy.fade, w = cz.fade;
+
+			for (std::size_t first = 0; first < count;)
+			{
+				std::size_t last = (first + 1);
+
+				while ((last < count) && (cells[last] == cells[first]))
+				{
+					++last;
+				}
+
+				std::int32_t h[Corners];
+				cornerHashes(first, h);
+
+				if constexpr (Corners == 4)
+				{
+					const GradX<Float> g0 = MakeGradX(h[0], y, Float(0));
+					const GradX<Float> g1 = MakeGradX(h[1], y, Float(0));
+					const GradX<Float> g2 = MakeGradX(h[2], y - 1, Float(0));
+					const GradX<Float> g3 = MakeGradX(h[3], y - 1, Float(0));
+
+					for (std::size_t i = first; i < last; ++i)
+					{
+						const Float x = fx[i];
+						const Float u = fu[i];
+
+						const Float p0 = EvalGradX(g0, x);
+						const Float p1 = EvalGradX(g1, x - 1);
+						const Float p2 = EvalGradX(g2, x);
+						const Float p3 = EvalGradX(g3, x - 1);
+
+						result[i] += (Lerp(Lerp(p0, p1, u), Lerp(p2, p3, u), v) * amplitude);
+					}
+				}
+				else
+				{
+					const GradX<Float> g0 = MakeGradX(h[0], y, z);
+					const GradX<Float> g1 = MakeGradX(h[1], y, z);
+					const GradX<Float> g2 = MakeGradX(h[2], y - 1, z);
+					const GradX<Float> g3 = MakeGradX(h[3], y - 1, z);
+					const GradX<Float> g4 = MakeGradX(h[4], y, z - 1);
+					const GradX<Float> g5 = MakeGradX(h[5], y, z - 1);
+					const GradX<Float> g6 = MakeGradX(h[6], y - 1, z - 1);
+					const GradX<Float> g7 = MakeGradX(h[7], y - 1, z - 1);
+
+					for (std::size_t i = first; i < last; ++i)
+					{
+						const Float x = fx[i];
+						const Float u = fu[i];
+
+						const Float p0 = EvalGradX(g0, x);
+						const Float p1 = EvalGradX(g1, x - 1);
+						const Float p2 = EvalGradX(g2, x);
+						const Float p3 = EvalGradX(g3, x - 1);
+						const Float p4 = EvalGradX(g4, x);
+						const Float p5 = EvalGradX(g5, x - 1);
+						const Float p6 = EvalGradX(g6, x);
+						const Float p7 = EvalGradX(g7, x - 1);
+
+						const Float q0 = Lerp(p0, p1, u);
+						const Float q1 = Lerp(p2, p3, u);
+						const Float q2 = Lerp(p4, p5, u);
+						const Float q3 = Lerp(p6, p7, u);
+
+						const Float r0 = Lerp(q0, q1, v);
+						const Float r1 = Lerp(q2, q3, v);
+
+						result[i] += (Lerp(r0, r1, w) * amplitude);
+					}
+				}
+
+				first = last;
+			}
+		}
+
+		// Number of columns of the strips in which rows are evaluated octave by octave, for blocks of N samples
+		template <std::size_t N>
+		inline constexpr std::size_t StripWidth = ((N < 64) ? 64 : N);
+
+		// Fills a 2D grid with transform(octave noise). Each row is evaluated in strips of StripWidth samples, one octave at a time,
+		// so that octaves with several samples per lattice cell can be evaluated cell by cell with AccumulateCellRuns().
+		// The other octaves are evaluated with NoiseBlock(). The result is the same as summing NoiseBlock() over all octaves.
+		template <NoiseKernel Kernel, std::size_t N, class Float, class Output, class Transform>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void FillOctave2DRows(const std::uint8_t* p, Output* dst, const BasicNoiseGrid<Float>& grid,
+			const std::int32_t octaves, const Float persistence, Transform transform) noexcept
+		{
+			constexpr std::size_t S = StripWidth<N>;
+			constexpr bool Dedicated = (Kernel == NoiseKernel::Dedicated);
+			const AxisCell<Float> cz = MakeAxisCell(static_cast<Float>(SIVPERLIN_DEFAULT_Z));
+
+			for (std::size_t j = 0; j < grid.height; ++j)
+			{
+				const Float y = (grid.y + static_cast<Float>(grid.offsetY + static_cast<std::int64_t>(j)) * grid.stepY);
+
+				for (std::size_t i0 = 0; i0 < grid.width; i0 += S)
+				{
+					const std::size_t count = std::min(S, (grid.width - i0));
+					const std::size_t lanes = (((count + N - 1) / N) * N);
+					Float xs[S], result[S] = {};
+					Float ys[N], zs[N];
+					Float yo = y, spacing = grid.stepX, amplitude = 1;
+
+					for (std::size_t i = 0; i < lanes; ++i)
+					{
+						xs[i] = (grid.x + static_cast<Float>(grid.offsetX + static_cast<std::int64_t>(i0 + i)) * grid.stepX);
+					}
+
+					for (std::int32_t o = 0; o < octaves; ++o)
+					{
+						if (IsCellCoherent(spacing))
+						{
+							std::int32_t cells[S];
+							Float fx[S], fu[S];
+
+							for (std::size_t i = 0; i < count; ++i)
+							{
+								const Float x = WrapCoordinate(xs[i]);
+								const std::int32_t x0 = FastFloor(x);
+								cells[i] = x0;
+								fx[i] = (x - static_cast<Float>(x0));
+								fu[i] = Fade(fx[i]);
+							}
+
+							const AxisCell<Float> cy = MakeAxisCell(yo);
+
+							AccumulateCellRuns<(Dedicated ? 4 : 8)>(cells, fx, fu, count, cy, cz, amplitude, result, [&](const std::size_t i, std::int32_t* h)
+							{
+								const std::int32_t ix = (cells[i] & 255);
+								const std::int32_t A = (p[ix] + cy.cell);
+								const std::int32_t B = (p[ix + 1] + cy.cell);
+
+								if constexpr (Dedicated)
+								{
+									h[0] = p[A];
+									h[1] = p[B];
+									h[2] = p[A + 1];
+									h[3] = p[B + 1];
+								}
+								else
+								{
+									const std::int32_t AA = (p[A] + cz.cell);
+									const std::int32_t AB = (p[A + 1] + cz.cell);
+									const std::int32_t BA = (p[B] + cz.cell);
+									const std::int32_t BB = (p[B + 1] + cz.cell);
+									h[0] = p[AA];
+									h[1] = p[BA];
+									h[2] = p[AB];
+									h[3] = p[BB];
+									h[4] = p[AA + 1];
+									h[5] = p[BA + 1];
+									h[6] = p[AB + 1];
+									h[7] = p[BB + 1];
+								}
+							});
+						}
+						else
+						{
+							for (std::size_t i = 0; i < N; ++i)
+							{
+								ys[i] = yo;
+								zs[i] = static_cast<Float>(SIVPERLIN_DEFAULT_Z);
+							}
+
+							for (std::size_t b = 0; b < lanes; b += N)
+							{
+								Float n[N];
+
+								NoiseBlock<2, Kernel, Float, N>(p, (xs + b), ys, zs, n);
+
+								for (std::size_t i = 0; i < N; ++i)
+								{
+									result[b + i] += (n[i] * amplitude);
+								}
+							}
+						}
+
+						for (std::size_t i = 0; i < lanes; ++i)
+						{
+							xs[i] *= 2;
+						}
+
+						yo *= 2;
+						spacing *= 2;
+						amplitude *= persistence;
+					}
+
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						dst[j * grid.width + i0 + i] = transform(result[i]);
+					}
+				}
+			}
+		}
+
+		// Fills a 3D grid with transform(octave noise) like FillOctave(), but the lattice cells, fractional coordinates and fade weights,
+		// which each depend on only one axis, are computed once per column, row and slice for each octave instead of once per sample.
+		// The grid is processed in strips of StripWidth columns, and each row of a strip is swept through all slices.
+		// The x tables of a strip are shared by all rows, and the first two levels of the corner hashes, which do not depend on z,
+		// are shared by all slices of a row, so only the last level of the hashes and the trilinear blend remain per sample.
+		// Octaves with several samples per lattice cell are evaluated cell by cell with AccumulateCellRuns().
+		// Octaves beyond TableOctaves are evaluated with NoiseBlock3D(). The result is the same as summing NoiseBlock3D() over all octaves.
+		template <std::size_t N, class Float, class Output, class Transform>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void FillOctave3DSeparable(const std::uint8_t* p, Output* dst, const BasicNoiseGrid<Float>& grid,
+			const std::int32_t octaves, const Float persistence, Transform transform) noexcept
+		{
+			constexpr std::size_t S = StripWidth<N>;
+			constexpr std::int32_t TableOctaves = 16;
+			const std::int32_t tableOctaves = std::min(octaves, TableOctaves);
+
+			bool coherent[TableOctaves] = {};
+			{
+				Float spacing = grid.stepX;
+
+				for (std::int32_t o = 0; o < tableOctaves; ++o)
+				{
+					coherent[o] = IsCellCoherent(spacing);
+					spacing *= 2;
+				}
+			}
+
+			for (std::size_t i0 = 0; i0 < grid.width; i0 += S)
+			{
+				const std::size_t stripWidth = std::min(S, (grid.width - i0));
+				const std::size_t lanes = (((stripWidth + N - 1) / N) * N);
+
+				// floor(x), p[cell] and p[cell + 1] of each column
+				std::int32_t cx[TableOctaves][S], px[TableOctaves][2][S];
+				Float fx[TableOctaves][S], fu[TableOctaves][S];
+				Float xRest[S];
+
+				for (std::size_t i = 0; i < lanes; ++i)
+				{
+					Float x = (grid.x + static_cast<Float>(grid.offsetX + static_cast<std::int64_t>(i0 + i)) * grid.stepX);
+
+					for (std::int32_t o = 0; o < tableOctaves; ++o)
+					{
+						const AxisCell<Float> c = MakeAxisCell(x);
+						cx[o][i] = FastFloor(WrapCoordinate(x));
+						px[o][0][i] = p[c.cell];
+						px[o][1][i] = p[c.cell + 1];
+						fx[o][i] = c.f;
+						fu[o][i] = c.fade;
+						x *= 2;
+					}
+
+					xRest[i] = x;
+				}
+
+				for (std::size_t j = 0; j < grid.height; ++j)
+				{
+					const Float y = (grid.y + static_cast<Float>(grid.offsetY + static_cast<std::int64_t>(j)) * grid.stepY);
+					AxisCell<Float> cy[TableOctaves];
+					Float yRest = y;
+
+					// p[A], p[B], p[A + 1] and p[B + 1] of each column of the row
+					std::int32_t pxy[TableOctaves][4][S];
+
+					for (std::int32_t o = 0; o < tableOctaves; ++o)
+					{
+						cy[o] = MakeAxisCell(yRest);
+						yRest *= 2;
+
+						for (std::size_t i = 0; i < lanes; ++i)
+						{
+							const std::int32_t A = (px[o][0][i] + cy[o].cell);
+							const std::int32_t B = (px[o][1][i] + cy[o].cell);
+							pxy[o][0][i] = p[A];
+							pxy[o][1][i] = p[B];
+							pxy[o][2][i] = p[A + 1];
+							pxy[o][3][i] = p[B + 1];
+						}
+					}
+
+					for (std::size_t k = 0; k < grid.depth; ++k)
+					{
+						const Float z = (grid.z + static_cast<Float>(grid.offsetZ + static_cast<std::int64_t>(k)) * grid.stepZ);
+						const std::size_t row = ((k * grid.height + j) * grid.width + i0);
+						Float result[S] = {};
+						Float zo = z, amplitude = 1;
+
+						for (std::int32_t o = 0; o < tableOctaves; ++o)
+						{
+							const AxisCell<Float> cz = MakeAxisCell(zo);
+							const std::int32_t iz = cz.cell;
+							zo *= 2;
+
+							if (coherent[o])
+							{
+								AccumulateCellRuns<8>(cx[o], fx[o], fu[o], stripWidth, cy[o], cz, amplitude, result, [&](const std::size_t i, std::int32_t* h)
+								{
+									const std::int32_t AA = (pxy[o][0][i] + iz);
+									const std::int32_t BA = (pxy[o][1][i] + iz);
+									const std::int32_t AB = (pxy[o][2][i] + iz);
+									const std::int32_t BB = (pxy[o][3][i] + iz);
+									h[0] = p[AA];
+									h[1] = p[BA];
+									h[2] = p[AB];
+									h[3] = p[BB];
+									h[4] = p[AA + 1];
+									h[5] = p[BA + 1];
+									h[6] = p[AB + 1];
+									h[7] = p[BB + 1];
+								});
+
+								amplitude *= persistence;
+								continue;
+							}
+
+							const Float y0 = cy[o].f, z0 = cz.f;
+							const Float v = cy[o].fade, w = cz.fade;
+
+							for (std::size_t b = 0; b < lanes; b += N)
+							{
+								std::int32_t h[8][N];
+
+								for (std::size_t i = 0; i < N; ++i)
+								{
+									const std::int32_t AA = (pxy[o][0][b + i] + iz);
+									const std::int32_t BA = (pxy[o][1][b + i] + iz);
+									const std::int32_t AB = (pxy[o][2][b + i] + iz);
+									const std::int32_t BB = (pxy[o][3][b + i] + iz);
+									h[0][i] = p[AA];
+									h[1][i] = p[BA];
+									h[2][i] = p[AB];
+									h[3][i] = p[BB];
+									h[4][i] = p[AA + 1];
+									h[5][i] = p[BA + 1];
+									h[6][i] = p[AB + 1];
+									h[7][i] = p[BB + 1];
+								}
+
+								for (std::size_t i = 0; i < N; ++i)
+								{
+									const Float x = fx[o][b + i];
+									const Float u = fu[o][b + i];
+
+									const Float p0 = Grad(h[0][i], x, y0, z0);
+									const Float p1 = Grad(h[1][i], x - 1, y0, z0);
+									const Float p2 = Grad(h[2][i], x, y0 - 1, z0);
+									const Float p3 = Grad(h[3][i], x - 1, y0 - 1, z0);
+									const Float p4 = Grad(h[4][i], x, y0, z0 - 1);
+									const Float p5 = Grad(h[5][i], x - 1, y0, z0 - 1);
+									const Float p6 = Grad(h[6][i], x, y0 - 1, z0 - 1);
+									const Float p7 = Grad(h[7][i], x - 1, y0 - 1, z0 - 1);
+
+									const Float q0 = Lerp(p0, p1, u);
+									const Float q1 = Lerp(p2, p3, u);
+									const Float q2 = Lerp(p4, p5, u);
+									const Float q3 = Lerp(p6, p7, u);
+
+									const Float r0 = Lerp(q0, q1, v);
+									const Float r1 = Lerp(q2, q3, v);
+
+									result[b + i] += (Lerp(r0, r1, w) * amplitude);
+								}
+							}
+
+							amplitude *= persistence;
+						}
+
+						if (tableOctaves < octaves)
+						{
+							for (std::size_t b = 0; b < lanes; b += N)
+							{
+								Float xs[N], ys[N], zs[N], n[N];
+								Float a = amplitude;
+
+								for (std::size_t i = 0; i < N; ++i)
+								{
+									xs[i] = xRest[b + i];
+									ys[i] = yRest;
+									zs[i] = zo;
+								}
+
+								for (std::int32_t o = tableOctaves; o < octaves; ++o)
+								{
+									NoiseBlock3D<Float, N>(p, xs, ys, zs, n);
+
+									for (std::size_t i = 0; i < N; ++i)
+									{
+										result[b + i] += (n[i] * a);
+										xs[i] *= 2;
+										ys[i] *= 2;
+										zs[i] *= 2;
+									}
+
+									a *= persistence;
+								}
+							}
+						}
+
+						for (std::size_t i = 0; i < stripWidth; ++i)
+						{
+							dst[row + i] = transform(result[i]);
+						}
+					}
+				}
+			}
+		}
+
+		// Fills a grid with transform(octave noise) in blocks of N samples. transform also converts the value to Output.
+		template <std::int32_t Dimension, NoiseKernel Kernel, std::size_t N, class Float, class Output, class Transform>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void FillOctaveLanes(const std::uint8_t* p, Output* dst, const BasicNoiseGrid<Float>& grid,
+			const std::int32_t octaves, const Float persistence, Transform transform) noexcept
+		{
+			if constexpr (Kernel == NoiseKernel::Simplex)
+			{
+				// The lattice of NoiseKernel::Simplex is not aligned with the grid axes, so each block is evaluated on its own
+				ForEachBlock<Dimension, N>(grid, [&](Float* xs, Float* ys, Float* zs, const std::size_t index, const std::size_t count)
+				{
+					Float n[N], result[N] = {};
+					Float amplitude = 1;
+
+					for (std::int32_t o = 0; o < octaves; ++o)
+					{
+						NoiseBlock<Dimension, Kernel, Float, N>(p, xs, ys, zs, n);
+
+						for (std::size_t i = 0; i < N; ++i)
+						{
+							result[i] += (n[i] * amplitude);
+							xs[i] *= 2;
+							ys[i] *= 2;
+							zs[i] *= ((Dimension == 3) ? 2 : 1);
+						}
+
+						amplitude *= persistence;
+					}
+
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						dst[index + i] = transform(result[i]);
+					}
+				});
+			}
+			else if constexpr (Dimension == 3)
+			{
+				FillOctave3DSeparable<N>(p, dst, grid, octaves, persistence, transform);
+			}
+			else
+			{
+				FillOctave2DRows<Kernel, N>(p, dst, grid, octaves, persistence, transform);
+			}
+		}
+
+	# if SIVPERLIN_HAS_RUNTIME_DISPATCH
+
+	# if defined(__clang__)
+	#	define SIVPERLIN_NO_FP_CONTRACT
+	# else
+	#	define SIVPERLIN_NO_FP_CONTRACT gnu::optimize("fp-contract=off"),
+	# endif
+
+		// FillOctaveLanes() compiled for the compiler flags, AVX2 and AVX-512F. flatten inlines the whole fill, so that the block loops are vectorized for the target.
+		// AVX-512F implies FMA, and the compiler flags may enable it too (-mfma), so contraction is turned off at every level to give the same results.
+		// GCC does so for these functions. Clang has no such attribute, so the pragma at the top of this header turns it off for the whole library.
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, class Output, class Transform>
+		[[SIVPERLIN_NO_FP_CONTRACT gnu::flatten]]
+		inline void FillOctaveBaseline(const std::uint8_t* p, Output* dst, const BasicNoiseGrid<Float>& grid,
+			const std::int32_t octaves, const Float persistence, Transform transform) noexcept
+		{
+			FillOctaveLanes<Dimension, Kernel, SimdLanes<Float>>(p, dst, grid, octaves, persistence, transform);
+		}
+
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, class Output, class Transform>
+		[[gnu::target("avx2"), SIVPERLIN_NO_FP_CONTRACT gnu::flatten]]
+		inline void FillOctaveAVX2(const std::uint8_t* p, Output* dst, const BasicNoiseGrid<Float>& grid,
+			const std::int32_t octaves, const Float persistence, Transform transform) noexcept
+		{
+			FillOctaveLanes<Dimension, Kernel, std::max<std::size_t>(4, (32 / sizeof(Float)))>(p, dst, grid, octaves, persistence, transform);
+		}
+
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, class Output, class Transform>
+		[[gnu::target("avx512f"), SIVPERLIN_NO_FP_CONTRACT gnu::flatten]]
+		inline void FillOctaveAVX512(const std::uint8_t* p, Output* dst, const BasicNoiseGrid<Float>& grid,
+			const std::int32_t octaves, const Float persistence, Transform transform) noexcept
+		{
+			FillOctaveLanes<Dimension, Kernel, (64 / sizeof(Float))>(p, dst, grid, octaves, persistence, transform);
+		}
+
+	# endif
+
+		// Fills a grid with transform(octave noise). transform also converts the value to Output.
+		// With SIVPERLIN_RUNTIME_DISPATCH, floating-point fills use the blocks of GetNoiseSimdLevel() if they are wider than SIVPERLIN_SIMD_BYTES.
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, class Output, class Transform>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void FillOctave(const std::uint8_t* p, Output* dst, const BasicNoiseGrid<Float>& grid,
+			const std::int32_t octaves, const Float persistence, Transform transform) noexcept
+		{
+		# if SIVPERLIN_HAS_RUNTIME_DISPATCH
+
+			if constexpr (std::is_floating_point_v<Float>)
+			{
+			# if __cpp_lib_is_constant_evaluated
+				if (not std::is_constant_evaluated())
+			# endif
+				{
+					const NoiseSimdLevel level = GetNoiseSimdLevel();
+
+					if ((level == NoiseSimdLevel::AVX512) && (SIVPERLIN_SIMD_BYTES < 64))
+					{
+						FillOctaveAVX512<Dimension, Kernel>(p, dst, grid, octaves, persistence, transform);
+						return;
+					}
+					else if ((level == NoiseSimdLevel::AVX2) && (SIVPERLIN_SIMD_BYTES < 32))
+					{
+						FillOctaveAVX2<Dimension, Kernel>(p, dst, grid, octaves, persistence, transform);
+						return;
+					}
+					else
+					{
+						FillOctaveBaseline<Dimension, Kernel>(p, dst, grid, octaves, persistence, transform);
+						return;
+					}
+				}
+			}
+
+		# endif
+
+			FillOctaveLanes<Dimension, Kernel, SimdLanes<Float>>(p, dst, grid, octaves, persistence, transform);
+		}
+
+		// Fills the levels of an octave noise pyramid from a single pass over level 0 (grid).
+		// levelOctaves is non-increasing. Each level is stored when the sum of level 0 reaches its octave count.
+		template <NoiseKernel Kernel, class Float, class Output, class Transform>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void FillOctavePyramid(const std::uint8_t* p, Output* const* dst, const BasicNoiseGrid<Float>& grid,
+			const std::size_t levels, const std::int32_t* levelOctaves, const Float persistence, Transform transform) noexcept
+		{
+			constexpr std::size_t N = SimdLanes<Float>;
+
+			ForEachBlock<2, N>(grid, [&](Float* xs, Float* ys, Float* zs, const std::size_t index, const std::size_t count)
+			{
+				const std::size_t j = (index / grid.width);
+				const std::size_t i0 = (index % grid.width);
+				Float n[N], result[N] = {};
+				Float amplitude = 1;
+				std::int32_t o = 0;
+
+				// From the coarsest level, which needs the fewest octaves
+				for (std::size_t level = levels; level-- != 0;)
+				{
+					for (; o < levelOctaves[level]; ++o)
+					{
+						NoiseBlock<2, Kernel, Float, N>(p, xs, ys, zs, n);
+
+						for (std::size_t i = 0; i < N; ++i)
+						{
+							result[i] += (n[i] * amplitude);
+							xs[i] *= 2;
+							ys[i] *= 2;
+						}
+
+						amplitude *= persistence;
+					}
+
+					const std::size_t mask = ((std::size_t{ 1 } << level) - 1);
+
+					if (j & mask)
+					{
+						continue;
+					}
+
+					Output* row = (dst[level] + (j >> level) * ((grid.width + mask) >> level));
+
+					for (std::size_t i = ((0 - i0) & mask); i < count; i += (mask + 1))
+					{
+						row[(i0 + i) >> level] = transform(result[i]);
+					}
+				}
+			});
+		}
+
+		// Octave noise of a single sample with each of K permutation tables. Like AccumulateOctaves(), M octaves are evaluated together in SIMD lanes
+		// while at least M remain, and the octaves are summed in order.
+		template <std::int32_t Dimension, NoiseKernel Kernel, std::size_t M, class Float, std::size_t K>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void AccumulateOctaveBank(const PermutationTable* tables, OctaveState<Float>& state, const Float persistence, std::array<Float, K>& result) noexcept
+		{
+			while (static_cast<std::int32_t>(M) <= state.remaining)
+			{
+				Float xs[M], ys[M], zs[M], amplitudes[M], n[K][M];
+
+				for (std::size_t i = 0; i < M; ++i)
+				{
+					xs[i] = state.x;
+					ys[i] = state.y;
+					zs[i] = state.z;
+					amplitudes[i] = state.amplitude;
+
+					state.x *= 2;
+					state.y *= 2;
+
+					if constexpr (Dimension == 3)
+					{
+						state.z *= 2;
+					}
+
+					state.amplitude *= persistence;
+				}
+
+				NoiseBankBlock<Dimension, Kernel, Float, M, K>(tables, xs, ys, zs, n);
+
+				for (std::size_t k = 0; k < K; ++k)
+				{
+					for (std::size_t i = 0; i < M; ++i)
+					{
+						result[k] += (n[k][i] * amplitudes[i]);
+					}
+				}
+
+				state.remaining -= static_cast<std::int32_t>(M);
+			}
+
+			if constexpr (1 < M)
+			{
+				AccumulateOctaveBank<Dimension, Kernel, 1>(tables, state, persistence, result);
+			}
+		}
+
+		// Fills a grid with transform(octave noise) of each of K permutation tables
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, std::size_t K, class Output, class Transform>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void FillOctaveBank(const PermutationTable* tables, Output* dst, const BasicNoiseGrid<Float>& grid,
+			const std::int32_t octaves, const Float persistence, const NoiseBankLayout layout, Transform transform) noexcept
+		{
+			constexpr std::size_t N = SimdLanes<Float>;
+			const std::size_t plane = (grid.width * grid.height * ((Dimension == 3) ? grid.depth : 1));
+
+			ForEachBlock<Dimension, N>(grid, [&](Float* xs, Float* ys, Float* zs, const std::size_t index, const std::size_t count)
+			{
+				Float result[K][N];
+
+				OctaveBankBlock<Dimension, Kernel, Float, N, K>(tables, xs, ys, zs, octaves, persistence, result);
+
+				if (layout == NoiseBankLayout::Interleaved)
+				{
+					for (std::size_t i = 0; i < count; ++i)
+					{
+						for (std::size_t k = 0; k < K; ++k)
+						{
+							dst[(index + i) * K + k] = transform(result[k][i]);
+						}
+					}
+				}
+				else
+				{
+					for (std::size_t k = 0; k < K; ++k)
+					{
+						for (std::size_t i = 0; i < count; ++i)
+						{
+							dst[k * plane + index + i] = transform(result[k][i]);
+						}
+					}
+				}
+			});
+		}
+
+		// Octave noise of N samples, with the octaves summed in the same order as octaveND()
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void OctaveBlock(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs,
+			const std::int32_t octaves, const Float persistence, Float* result) noexcept
+		{
+			Float x[N], y[N], z[N], n[N];
+			Float amplitude = 1;
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				x[i] = xs[i];
+				y[i] = ys[i];
+				z[i] = zs[i];
+				result[i] = 0;
+			}
+
+			for (std::int32_t o = 0; o < octaves; ++o)
+			{
+				NoiseBlock<Dimension, Kernel, Float, N>(p, x, y, z, n);
+
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					result[i] += (n[i] * amplitude);
+					x[i] *= 2;
+					y[i] *= 2;
+					z[i] *= ((Dimension == 3) ? 2 : 1);
+				}
+
+				amplitude *= persistence;
+			}
+		}
+
+		// Offset of the position at which the displacement along each axis is evaluated, so that the axes are independent
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float WarpOffset(const std::size_t axis, const std::size_t component) noexcept
+		{
+			constexpr double Offsets[3][3] = { { 0.0, 0.0, 0.0 }, { 5.2, 1.3, 2.8 }, { 1.7, 9.2, 4.1 } };
+
+			return static_cast<Float>(Offsets[axis][component]);
+		}
+
+		// Displaces N positions by warp. The displacement along each axis is evaluated with OctaveBlock().
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void WarpBlock(const std::uint8_t* p, Float* xs, Float* ys, Float* zs, const BasicNoiseWarp<Float>& warp) noexcept
+		{
+			for (std::int32_t level = 0; level < warp.depth; ++level)
+			{
+				Float q[Dimension][N];
+
+				for (std::size_t axis = 0; axis < static_cast<std::size_t>(Dimension); ++axis)
+				{
+					Float wx[N], wy[N], wz[N];
+
+					for (std::size_t i = 0; i < N; ++i)
+					{
+						wx[i] = (xs[i] + WarpOffset<Float>(axis, 0));
+						wy[i] = (ys[i] + WarpOffset<Float>(axis, 1));
+						wz[i] = ((Dimension == 3) ? (zs[i] + WarpOffset<Float>(axis, 2)) : zs[i]);
+					}
+
+					OctaveBlock<Dimension, Kernel, Float, N>(p, wx, wy, wz, warp.octaves, warp.persistence, q[axis]);
+				}
+
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					xs[i] += (warp.strength * q[0][i]);
+					ys[i] += (warp.strength * q[1][i]);
+
+					if constexpr (Dimension == 3)
+					{
+						zs[i] += (warp.strength * q[2][i]);
+					}
+				}
+			}
+		}
+
+		// Domain-warped octave noise of a single sample. The displacements along all axes are evaluated together in SIMD lanes.
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float>
+		[[nodiscard]]
+		inline SIVPERLIN_CONSTEXPR_CXX20 Float WarpedOctave(const std::uint8_t* p, Float x, Float y, Float z, const BasicNoiseWarp<Float>& warp,
+			const std::int32_t octaves, const Float persistence) noexcept
+		{
+			constexpr std::size_t D = static_cast<std::size_t>(Dimension);
+
+			for (std::int32_t level = 0; level < warp.depth; ++level)
+			{
+				Float wx[D], wy[D], wz[D], q[D];
+
+				for (std::size_t axis = 0; axis < D; ++axis)
+				{
+					wx[axis] = (x + WarpOffset<Float>(axis, 0));
+					wy[axis] = (y + WarpOffset<Float>(axis, 1));
+					wz[axis] = ((Dimension == 3) ? (z + WarpOffset<Float>(axis, 2)) : z);
+				}
+
+				OctaveBlock<Dimension, Kernel, Float, D>(p, wx, wy, wz, warp.octaves, warp.persistence, q);
+
+				x += (warp.strength * q[0]);
+				y += (warp.strength * q[1]);
+
+				if constexpr (Dimension == 3)
+				{
+					z += (warp.strength * q[2]);
+				}
+			}
+
+			return Octave<Dimension, Kernel>(p, x, y, z, octaves, persistence);
+		}
+
+		// Fills a grid with transform(domain-warped octave noise)
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, class Output, class Transform>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void FillWarpedOctave(const std::uint8_t* p, Output* dst, const BasicNoiseGrid<Float>& grid, const BasicNoiseWarp<Float>& warp,
+			const std::int32_t octaves, const Float persistence, Transform transform) noexcept
+		{
+			constexpr std::size_t N = SimdLanes<Float>;
+
+			ForEachBlock<Dimension, N>(grid, [&](Float* xs, Float* ys, Float* zs, const std::size_t index, const std::size_t count)
+			{
+				Float result[N];
+
+				WarpBlock<Dimension, Kernel, Float, N>(p, xs, ys, zs, warp);
+
+				OctaveBlock<Dimension, Kernel, Float, N>(p, xs, ys, zs, octaves, persistence, result);
+
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					dst[index + i] = transform(result[i]);
+				}
+			});
+		}
+
+		// Replaces coordinates beyond 2^62 (and infinities and NaN) with 0, so that WideFloor() does not overflow
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr Float LimitCoordinate(const Float x) noexcept
+		{
+			if constexpr (IsFixedPoint<Float>)
+			{
+				return x;
+			}
+			else
+			{
+				constexpr Float Limit = Pow2<Float>(62);
+				return (((-Limit < x) && (x < Limit)) ? x : Float(0));
+			}
+		}
+
+		// Same as FastFloor(), but in 64 bits. Periods do not in general divide 2^30, so WrapCoordinate() cannot be used for periodic noise.
+		template <class Float>
+		[[nodiscard]]
+		inline constexpr std::int64_t WideFloor(const Float x) noexcept
+		{
+			if constexpr (IsFixedPoint<Float>)
+			{
+				return static_cast<std::int64_t>(x);
+			}
+			else
+			{
+				const std::int64_t i = static_cast<std::int64_t>(x);
+				return (i - static_cast<std::int64_t>(x < static_cast<Float>(i)));
+			}
+		}
+
+		// Lattice corners i0 = floor(x) and i1 = i0 + 1 of N samples, wrapped to the period and then to 256, and the fractional coordinates
+		template <class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void PeriodicCellBlock(const Float* xs, const std::int64_t period,
+			std::int32_t (&i0)[N], std::int32_t (&i1)[N], Float (&f)[N]) noexcept
+		{
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				const Float x = LimitCoordinate(xs[i]);
+				const std::int64_t c = WideFloor(x);
+				std::int64_t m = (c % period);
+				m += ((m < 0) ? period : 0);
+				i0[i] = static_cast<std::int32_t>(m & 255);
+				i1[i] = static_cast<std::int32_t>(((m + 1 == period) ? 0 : (m + 1)) & 255);
+				f[i] = (x - static_cast<Float>(c));
+			}
+		}
+
+		// Evaluates periodic noiseND() of the given kernel for N samples. period holds the periods of the x, y and z lattice coordinates.
+		// With periods that are multiples of 256, the result is the same as NoiseBlock().
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void PeriodicNoiseBlock(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs,
+			const std::int64_t (&period)[3], Float* out) noexcept
+		{
+			static_assert((Kernel != NoiseKernel::Simplex), "Periodic noise is not available with NoiseKernel::Simplex");
+
+			std::int32_t x0[N], x1[N];
+			Float fx[N];
+
+			PeriodicCellBlock(xs, period[0], x0, x1, fx);
+
+			if constexpr ((Dimension == 1) && (Kernel == NoiseKernel::Dedicated))
+			{
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					const Float x = fx[i];
+					out[i] = Lerp(Grad1D(p[x0[i]], x), Grad1D(p[x1[i]], x - 1), Fade(x));
+				}
+			}
+			else if constexpr ((Dimension == 2) && (Kernel == NoiseKernel::Dedicated))
+			{
+				std::int32_t y0[N], y1[N];
+				Float fy[N];
+
+				PeriodicCellBlock(ys, period[1], y0, y1, fy);
+
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					const Float x = fx[i], y = fy[i];
+					const Float u = Fade(x);
+					const Float v = Fade(y);
+					const std::int32_t A = p[x0[i]];
+					const std::int32_t B = p[x1[i]];
+
+					const Float p0 = Grad2D(p[A + y0[i]], x, y);
+					const Float p1 = Grad2D(p[B + y0[i]], x - 1, y);
+					const Float p2 = Grad2D(p[A + y1[i]], x, y - 1);
+					const Float p3 = Grad2D(p[B + y1[i]], x - 1, y - 1);
+
+					out[i] = Lerp(Lerp(p0, p1, u), Lerp(p2, p3, u), v);
+				}
+			}
+			else
+			{
+				std::int32_t y0[N], y1[N], z0[N], z1[N];
+				Float fy[N], fz[N];
+
+				PeriodicCellBlock(ys, period[1], y0, y1, fy);
+				PeriodicCellBlock(zs, period[2], z0, z1, fz);
+
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					const Float x = fx[i], y = fy[i], z = fz[i];
+					const Float u = Fade(x);
+					const Float v = Fade(y);
+					const Float w = Fade(z);
+					const std::int32_t A = p[x0[i]];
+					const std::int32_t B = p[x1[i]];
+					const std::int32_t AA = p[A + y0[i]];
+					const std::int32_t AB = p[A + y1[i]];
+					const std::int32_t BA = p[B + y0[i]];
+					const std::int32_t BB = p[B + y1[i]];
+
+					const Float p0 = Grad(p[AA + z0[i]], x, y, z);
+					const Float p1 = Grad(p[BA + z0[i]], x - 1, y, z);
+					const Float p2 = Grad(p[AB + z0[i]], x, y - 1, z);
+					const Float p3 = Grad(p[BB + z0[i]], x - 1, y - 1, z);
+					const Float p4 = Grad(p[AA + z1[i]], x, y, z - 1);
+					const Float p5 = Grad(p[BA + z1[i]], x - 1, y, z - 1);
+					const Float p6 = Grad(p[AB + z1[i]], x, y - 1, z - 1);
+					const Float p7 = Grad(p[BB + z1[i]], x - 1, y - 1, z - 1);
+
+					const Float q0 = Lerp(p0, p1, u);
+					const Float q1 = Lerp(p2, p3, u);
+					const Float q2 = Lerp(p4, p5, u);
+					const Float q3 = Lerp(p6, p7, u);
+
+					const Float r0 = Lerp(q0, q1, v);
+					const Float r1 = Lerp(q2, q3, v);
+
+					out[i] = Lerp(r0, r1, w);
+				}
+			}
+		}
+
+		// Periodic octave noise of N samples. Octave o samples the lattice at 2^o times the frequency, so its period is also multiplied by 2^o
+		// and every octave tiles with the same period in the input coordinates.
+		// The periods of the axes beyond the dimension (the fixed y and z of NoiseKernel::Compatible) are 256, which is the same as noiseND().
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, std::size_t N>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void PeriodicOctaveBlock(const std::uint8_t* p, const Float* xs, const Float* ys, const Float* zs,
+			const std::int32_t (&periods)[3], const std::int32_t octaves, const Float persistence, Float* result) noexcept
+		{
+			Float x[N], y[N], z[N], n[N];
+			std::int64_t period[3] = { 256, 256, 256 };
+			Float amplitude = 1;
+
+			for (std::int32_t axis = 0; axis < Dimension; ++axis)
+			{
+				period[axis] = std::max(periods[axis], 1);
+			}
+
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				x[i] = xs[i];
+				y[i] = ys[i];
+				z[i] = zs[i];
+				result[i] = 0;
+			}
+
+			for (std::int32_t o = 0; o < octaves; ++o)
+			{
+				PeriodicNoiseBlock<Dimension, Kernel, Float, N>(p, x, y, z, period, n);
+
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					result[i] += (n[i] * amplitude);
+					x[i] *= 2;
+
+					if constexpr (2 <= Dimension)
+					{
+						y[i] *= 2;
+					}
+
+					if constexpr (3 <= Dimension)
+					{
+						z[i] *= 2;
+					}
+				}
+
+				for (std::int32_t axis = 0; axis < Dimension; ++axis)
+				{
+					// Past 2^32 the wrapped lattice coordinates are the same as for any larger multiple of 256
+					period[axis] = ((period[axis] < (std::int64_t(1) << 32)) ? (period[axis] * 2) : period[axis]);
+				}
 
-			for (std::int32_t i = 0; i < octaves; ++i)
-			{
-				result += (noise.noise3D(x, y, z) * amplitude);
-				x *= 2;
-				y *= 2;
-				z *= 2;
 				amplitude *= persistence;
 			}
+		}
+
+		// Fills a grid with transform(periodic octave noise)
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, class Output, class Transform>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void FillPeriodicOctave(const std::uint8_t* p, Output* dst, const BasicNoiseGrid<Float>& grid, const std::int32_t (&periods)[3],
+			const std::int32_t octaves, const Float persistence, Transform transform) noexcept
+		{
+			constexpr std::size_t N = SimdLanes<Float>;
+
+			ForEachBlock<Dimension, N>(grid, [&](Float* xs, Float* ys, Float* zs, const std::size_t index, const std::size_t count)
+			{
+				Float result[N];
+
+				PeriodicOctaveBlock<Dimension, Kernel, Float, N>(p, xs, ys, zs, periods, octaves, persistence, result);
+
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					dst[index + i] = transform(result[i]);
+				}
+			});
+		}
+
+		// Fills a grid with octave noise and its gradient (Derivative is BasicNoiseDerivative2D or BasicNoiseDerivative3D)
+		template <std::int32_t Dimension, NoiseKernel Kernel, class Float, class Derivative>
+		inline SIVPERLIN_CONSTEXPR_CXX20 void FillOctaveDerivative(const std::uint8_t* p, Derivative* dst, const BasicNoiseGrid<Float>& grid,
+			const std::int32_t octaves, const Float persistence) noexcept
+		{
+			constexpr std::size_t N = SimdLanes<Float>;
+
+			ForEachBlock<Dimension, N>(grid, [&](Float* xs, Float* ys, Float* zs, const std::size_t index, const std::size_t count)
+			{
+				BasicNoiseDerivative3D<Float> n[N], result[N];
+				Float amplitude = 1;
+				Float frequency = 1;
+
+				for (std::int32_t o = 0; o < octaves; ++o)
+				{
+					NoiseDerivativeBlock<Dimension, Kernel, Float, N>(p, xs, ys, zs, n);
+
+					const Float scale = (amplitude * frequency);
+
+					for (std::size_t i = 0; i < N; ++i)
+					{
+						result[i].value += (n[i].value * amplitude);
+						result[i].dx += (n[i].dx * scale);
+						result[i].dy += (n[i].dy * scale);
+						result[i].dz += (n[i].dz * scale);
+						xs[i] *= 2;
+						ys[i] *= 2;
+						zs[i] *= ((Dimension == 3) ? 2 : 1);
+					}
+
+					amplitude *= persistence;
+					frequency *= 2;
+				}
+
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					if constexpr (std::is_same_v<Derivative, BasicNoiseDerivative2D<Float>>)
+					{
+						dst[index + i] = ToDerivative2D(result[i]);
+					}
+					else
+					{
+						dst[index + i] = result[i];
+					}
+				}
+			});
+		}
+	}
+
+	///////////////////////////////////////
+
+	inline constexpr const char* NoiseEntryPointName(const NoiseEntryPoint entryPoint) noexcept
+	{
+		constexpr const char* Names[NoiseEntryPointCount] =
+		{
+			"noise1D", "noise2D", "noise3D",
+			"noise1D_01", "noise2D_01", "noise3D_01",
+			"octave1D", "octave2D", "octave3D",
+			"octave1D_11", "octave2D_11", "octave3D_11",
+			"octave1D_01", "octave2D_01", "octave3D_01",
+			"normalizedOctave1D", "normalizedOctave2D", "normalizedOctave3D",
+			"normalizedOctave1D_01", "normalizedOctave2D_01", "normalizedOctave3D_01",
+			"fillNoise2D", "fillNoise3D",
+			"fillNoise2D_01", "fillNoise3D_01",
+			"fillOctave2D", "fillOctave3D",
+			"fillOctave2D_11", "fillOctave3D_11",
+			"fillOctave2D_01", "fillOctave3D_01",
+			"fillNormalizedOctave2D", "fillNormalizedOctave3D",
+			"fillNormalizedOctave2D_01", "fillNormalizedOctave3D_01",
+			"reseed", "reseedFast",
+		};
+
+		return Names[static_cast<std::size_t>(entryPoint)];
+	}
+
+# if SIVPERLIN_ENABLE_INSTRUMENTATION
+
+	namespace perlin_detail
+	{
+		// Counters of one thread. Only that thread writes them, so they are updated with plain loads and stores instead of atomic read-modify-writes.
+		struct InstrumentationCounters
+		{
+			std::atomic<std::uint64_t> entryPoints[NoiseEntryPointCount][5] = {};
+
+			std::atomic<std::uint64_t> octaves[NoiseOctaveHistogramSize] = {};
+		};
+
+		inline void Increment(std::atomic<std::uint64_t>& counter, const std::uint64_t n) noexcept
+		{
+			counter.store((counter.load(std::memory_order_relaxed) + n), std::memory_order_relaxed);
+		}
+
+		inline void AddTo(NoiseInstrumentation& result, const InstrumentationCounters& counters) noexcept
+		{
+			for (std::size_t i = 0; i < NoiseEntryPointCount; ++i)
+			{
+				NoiseEntryPointStats& stats = result.entryPoints[i];
+				stats.calls += counters.entryPoints[i][0].load(std::memory_order_relaxed);
+				stats.samples += counters.entryPoints[i][1].load(std::memory_order_relaxed);
+				stats.timedCalls += counters.entryPoints[i][2].load(std::memory_order_relaxed);
+				stats.timedSamples += counters.entryPoints[i][3].load(std::memory_order_relaxed);
+				stats.ticks += counters.entryPoints[i][4].load(std::memory_order_relaxed);
+			}
+
+			for (std::size_t i = 0; i < NoiseOctaveHistogramSize; ++i)
+			{
+				result.octaves[i] += counters.octaves[i].load(std::memory_order_relaxed);
+			}
+		}
+
+		// The counters of the running threads, the sums of the threads that have exited, and the sums at the last reset
+		struct InstrumentationRegistry
+		{
+			std::mutex mutex;
+
+			std::list<const InstrumentationCounters*> threads;
+
+			NoiseInstrumentation exited;
+
+			NoiseInstrumentation baseline;
+		};
+
+		[[nodiscard]]
+		inline InstrumentationRegistry& GetInstrumentationRegistry()
+		{
+			static InstrumentationRegistry registry;
+			return registry;
+		}
+
+		class ThreadInstrumentation
+		{
+		public:
+
+			InstrumentationCounters counters;
+
+			// Nesting depth of the counted calls on this thread
+			std::uint32_t depth = 0;
+
+			// Calls until the next timed call
+			std::uint32_t countdown = 1;
+
+			ThreadInstrumentation()
+			{
+				InstrumentationRegistry& registry = GetInstrumentationRegistry();
+				const std::lock_guard lock{ registry.mutex };
+				m_node = registry.threads.insert(registry.threads.end(), &counters);
+			}
+
+			ThreadInstrumentation(const ThreadInstrumentation&) = delete;
+
+			ThreadInstrumentation& operator =(const ThreadInstrumentation&) = delete;
+
+			~ThreadInstrumentation()
+			{
+				InstrumentationRegistry& registry = GetInstrumentationRegistry();
+				const std::lock_guard lock{ registry.mutex };
+				AddTo(registry.exited, counters);
+				registry.threads.erase(m_node);
+			}
+
+		private:
+
+			std::list<const InstrumentationCounters*>::iterator m_node;
+		};
+
+		[[nodiscard]]
+		inline ThreadInstrumentation& GetThreadInstrumentation()
+		{
+			thread_local ThreadInstrumentation instrumentation;
+			return instrumentation;
+		}
+
+		[[nodiscard]]
+		inline std::uint64_t ReadTicks() noexcept
+		{
+		# if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+		# else
+			return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		# endif
+		}
+
+		// Counts a call of a BasicPerlinNoise function for the lifetime of the object (see NoiseEntryPoint)
+		class InstrumentationScope
+		{
+		public:
+
+			SIVPERLIN_CONSTEXPR_CXX20 InstrumentationScope(const NoiseEntryPoint entryPoint, const std::uint64_t samples) noexcept
+			{
+			# if __cpp_lib_is_constant_evaluated
+				if (std::is_constant_evaluated())
+				{
+					return;
+				}
+			# endif
+
+				begin(entryPoint, samples);
+			}
+
+			SIVPERLIN_CONSTEXPR_CXX20 InstrumentationScope(const NoiseEntryPoint entryPoint, const std::uint64_t samples, const std::int32_t octaves) noexcept
+			{
+			# if __cpp_lib_is_constant_evaluated
+				if (std::is_constant_evaluated())
+				{
+					return;
+				}
+			# endif
+
+				if (begin(entryPoint, samples))
+				{
+					const std::size_t bucket = static_cast<std::size_t>(std::clamp<std::int32_t>(octaves, 0, static_cast<std::int32_t>(NoiseOctaveHistogramSize - 1)));
+					Increment(m_thread->counters.octaves[bucket], 1);
+				}
+			}
+
+			InstrumentationScope(const InstrumentationScope&) = delete;
+
+			InstrumentationScope& operator =(const InstrumentationScope&) = delete;
+
+			SIVPERLIN_CONSTEXPR_CXX20 ~InstrumentationScope()
+			{
+				if (m_thread)
+				{
+					end();
+				}
+			}
+
+		private:
+
+			ThreadInstrumentation* m_thread = nullptr;
+
+			std::atomic<std::uint64_t>* m_stats = nullptr;
+
+			std::uint64_t m_samples = 0;
+
+			std::uint64_t m_start = 0;
+
+			// Returns true if the call is not nested in another counted call
+			bool begin(const NoiseEntryPoint entryPoint, const std::uint64_t samples) noexcept
+			{
+				m_thread = &GetThreadInstrumentation();
+
+				if (m_thread->depth++ != 0)
+				{
+					return false;
+				}
+
+				std::atomic<std::uint64_t>* stats = m_thread->counters.entryPoints[static_cast<std::size_t>(entryPoint)];
+				Increment(stats[0], 1);
+				Increment(stats[1], samples);
+
+				if constexpr (SIVPERLIN_INSTRUMENTATION_TIMING_INTERVAL != 0)
+				{
+					if (--m_thread->countdown == 0)
+					{
+						m_thread->countdown = static_cast<std::uint32_t>(SIVPERLIN_INSTRUMENTATION_TIMING_INTERVAL);
+						m_stats = stats;
+						m_samples = samples;
+						m_start = ReadTicks();
+					}
+				}
+
+				return true;
+			}
+
+			void end() noexcept
+			{
+				--m_thread->depth;
+
+				if (m_stats)
+				{
+					const std::uint64_t ticks = (ReadTicks() - m_start);
+					Increment(m_stats[2], 1);
+					Increment(m_stats[3], m_samples);
+					Increment(m_stats[4], ticks);
+				}
+			}
+		};
+
+		[[nodiscard]]
+		inline NoiseInstrumentation SumNoiseInstrumentation(const InstrumentationRegistry& registry) noexcept
+		{
+			NoiseInstrumentation result = registry.exited;
+
+			for (const InstrumentationCounters* counters : registry.threads)
+			{
+				AddTo(result, *counters);
+			}
+
+			return result;
+		}
+	}
+
+	inline NoiseInstrumentation GetNoiseInstrumentation()
+	{
+		perlin_detail::InstrumentationRegistry& registry = perlin_detail::GetInstrumentationRegistry();
+		const std::lock_guard lock{ registry.mutex };
+		NoiseInstrumentation result = perlin_detail::SumNoiseInstrumentation(registry);
+
+		// Counters only grow, so the counts since the reset are the differences from the baseline
+		for (std::size_t i = 0; i < NoiseEntryPointCount; ++i)
+		{
+			NoiseEntryPointStats& stats = result.entryPoints[i];
+			const NoiseEntryPointStats& baseline = registry.baseline.entryPoints[i];
+			stats.calls -= baseline.calls;
+			stats.samples -= baseline.samples;
+			stats.timedCalls -= baseline.timedCalls;
+			stats.timedSamples -= baseline.timedSamples;
+			stats.ticks -= baseline.ticks;
+		}
+
+		for (std::size_t i = 0; i < NoiseOctaveHistogramSize; ++i)
+		{
+			result.octaves[i] -= registry.baseline.octaves[i];
+		}
+
+		return result;
+	}
+
+	inline void ResetNoiseInstrumentation()
+	{
+		perlin_detail::InstrumentationRegistry& registry = perlin_detail::GetInstrumentationRegistry();
+		const std::lock_guard lock{ registry.mutex };
+		registry.baseline = perlin_detail::SumNoiseInstrumentation(registry);
+	}
+
+# else
+
+	inline NoiseInstrumentation GetNoiseInstrumentation()
+	{
+		return{};
+	}
+
+	inline void ResetNoiseInstrumentation() {}
+
+# endif
+
+	///////////////////////////////////////
+
+# if SIVPERLIN_HAS_RUNTIME_DISPATCH
+
+	namespace perlin_detail
+	{
+		[[nodiscard]]
+		inline NoiseSimdLevel InitialNoiseSimdLevel() noexcept
+		{
+			NoiseSimdLevel level = GetSupportedNoiseSimdLevel();
+
+			if (const char* name = std::getenv("SIVPERLIN_SIMD_LEVEL"))
+			{
+				const std::string_view value{ name };
+
+				if (value == "baseline")
+				{
+					level = NoiseSimdLevel::Baseline;
+				}
+				else if ((value == "avx2") && (NoiseSimdLevel::AVX2 < level))
+				{
+					level = NoiseSimdLevel::AVX2;
+				}
+			}
+
+			return level;
+		}
+
+		[[nodiscard]]
+		inline std::atomic<NoiseSimdLevel>& NoiseSimdLevelStorage() noexcept
+		{
+			static std::atomic<NoiseSimdLevel> level{ InitialNoiseSimdLevel() };
+			return level;
+		}
+	}
+
+	inline NoiseSimdLevel GetSupportedNoiseSimdLevel() noexcept
+	{
+		static const NoiseSimdLevel supported = []
+		{
+			__builtin_cpu_init();
+
+			if (__builtin_cpu_supports("avx512f"))
+			{
+				return NoiseSimdLevel::AVX512;
+			}
+			else if (__builtin_cpu_supports("avx2"))
+			{
+				return NoiseSimdLevel::AVX2;
+			}
+
+			return NoiseSimdLevel::Baseline;
+		}();
+
+		return supported;
+	}
+
+	inline NoiseSimdLevel GetNoiseSimdLevel() noexcept
+	{
+		return perlin_detail::NoiseSimdLevelStorage().load(std::memory_order_relaxed);
+	}
+
+	inline NoiseSimdLevel SetNoiseSimdLevel(const NoiseSimdLevel level) noexcept
+	{
+		const NoiseSimdLevel selected = std::min(level, GetSupportedNoiseSimdLevel());
+		perlin_detail::NoiseSimdLevelStorage().store(selected, std::memory_order_relaxed);
+		return selected;
+	}
+
+# else
+
+	inline NoiseSimdLevel GetSupportedNoiseSimdLevel() noexcept
+	{
+		return NoiseSimdLevel::Baseline;
+	}
+
+	inline NoiseSimdLevel GetNoiseSimdLevel() noexcept
+	{
+		return NoiseSimdLevel::Baseline;
+	}
+
+	inline NoiseSimdLevel SetNoiseSimdLevel(NoiseSimdLevel) noexcept
+	{
+		return NoiseSimdLevel::Baseline;
+	}
+
+# endif
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline constexpr BasicPerlinNoise<Float, Kernel>::BasicPerlinNoise() noexcept
+		: m_permutation{ perlin_detail::ExpandPermutation({ 151,160,137,91,90,15,
+				131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,8,99,37,240,21,10,23,
+				190, 6,148,247,120,234,75,0,26,197,62,94,252,219,203,117,35,11,32,57,177,33,
+				88,237,149,56,87,174,20,125,136,171,168, 68,175,74,165,71,134,139,48,27,166,
+				77,146,158,231,83,111,229,122,60,211,133,230,220,105,92,41,55,46,245,40,244,
+				102,143,54, 65,25,63,161, 1,216,80,73,209,76,132,187,208, 89,18,169,200,196,
+				135,130,116,188,159,86,164,100,109,198,173,186, 3,64,52,217,226,250,124,123,
+				5,202,38,147,118,126,255,82,85,212,207,206,59,227,47,16,58,17,182,189,28,42,
+				223,183,170,213,119,248,152, 2,44,154,163, 70,221,153,101,155,167, 43,172,9,
+				129,22,39,253, 19,98,108,110,79,113,224,232,178,185, 112,104,218,246,97,228,
+				251,34,242,193,238,210,144,12,191,179,162,241, 81,51,145,235,249,14,239,107,
+				49,192,214, 31,181,199,106,157,184, 84,204,176,115,121,50,45,127, 4,150,254,
+				138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180 }) } {}
+
+	template <class Float, NoiseKernel Kernel>
+	inline BasicPerlinNoise<Float, Kernel>::BasicPerlinNoise(const seed_type seed)
+	{
+		reseed(seed);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	SIVPERLIN_CONCEPT_URBG_
+	inline BasicPerlinNoise<Float, Kernel>::BasicPerlinNoise(URBG&& urbg)
+	{
+		reseed(std::forward<URBG>(urbg));
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline void BasicPerlinNoise<Float, Kernel>::reseed(const seed_type seed)
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Reseed, 1);
+
+		reseed(default_random_engine{ seed });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	SIVPERLIN_CONCEPT_URBG_
+	inline void BasicPerlinNoise<Float, Kernel>::reseed(URBG&& urbg)
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Reseed, 1);
+
+		const auto first = m_permutation.begin();
+		const auto last = (first + 256);
+
+		std::iota(first, last, uint8_t{ 0 });
+
+		perlin_detail::Shuffle(first, last, std::forward<URBG>(urbg));
+
+		std::copy(first, last, last);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_INSTRUMENTED void BasicPerlinNoise<Float, Kernel>::reseedFast(const std::uint64_t seed) noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::ReseedFast, 1);
+
+		m_permutation = perlin_detail::ExpandPermutation(perlin_detail::ShuffledIdentity(seed));
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline constexpr typename BasicPerlinNoise<Float, Kernel>::state_type BasicPerlinNoise<Float, Kernel>::serialize() const noexcept
+	{
+		state_type state{};
+
+		for (std::size_t i = 0; i < state.size(); ++i)
+		{
+			state[i] = m_permutation[i];
+		}
+
+		return state;
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline constexpr void BasicPerlinNoise<Float, Kernel>::deserialize(const state_type& state) noexcept
+	{
+		m_permutation = perlin_detail::ExpandPermutation(state);
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::noise1D(const value_type x) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Noise1D, 1);
+
+		if constexpr (Kernel == NoiseKernel::Simplex)
+		{
+			value_type result = 0;
+			perlin_detail::SimplexBlock1D<value_type, 1>(m_permutation.data(), &x, &result);
+			return result;
+		}
+		else if constexpr (Kernel == NoiseKernel::Compatible)
+		{
+			return noise3D(x,
+				static_cast<value_type>(SIVPERLIN_DEFAULT_Y),
+				static_cast<value_type>(SIVPERLIN_DEFAULT_Z));
+		}
+		else
+		{
+			const value_type wx = perlin_detail::WrapCoordinate(x);
+
+			const value_type _x = perlin_detail::Floor(wx);
+
+			const std::int32_t ix = static_cast<std::int32_t>(_x) & 255;
+
+			const value_type fx = (wx - _x);
+
+			const value_type u = perlin_detail::Fade(fx);
+
+			const value_type p0 = perlin_detail::Grad1D(m_permutation[ix], fx);
+			const value_type p1 = perlin_detail::Grad1D(m_permutation[ix + 1], fx - 1);
+
+			return perlin_detail::Lerp(p0, p1, u);
+		}
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::noise2D(const value_type x, const value_type y) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Noise2D, 1);
+
+		if constexpr (Kernel == NoiseKernel::Simplex)
+		{
+			value_type result = 0;
+			perlin_detail::SimplexBlock2D<value_type, 1>(m_permutation.data(), &x, &y, &result);
+			return result;
+		}
+		else if constexpr (Kernel == NoiseKernel::Compatible)
+		{
+			return noise3D(x,
+				y,
+				static_cast<value_type>(SIVPERLIN_DEFAULT_Z));
+		}
+		else
+		{
+			const value_type wx = perlin_detail::WrapCoordinate(x);
+			const value_type wy = perlin_detail::WrapCoordinate(y);
+
+			const value_type _x = perlin_detail::Floor(wx);
+			const value_type _y = perlin_detail::Floor(wy);
+
+			const std::int32_t ix = static_cast<std::int32_t>(_x) & 255;
+			const std::int32_t iy = static_cast<std::int32_t>(_y) & 255;
+
+			const value_type fx = (wx - _x);
+			const value_type fy = (wy - _y);
+
+			const value_type u = perlin_detail::Fade(fx);
+			const value_type v = perlin_detail::Fade(fy);
+
+			const std::int32_t A = (m_permutation[ix] + iy);
+			const std::int32_t B = (m_permutation[ix + 1] + iy);
+
+			const value_type p0 = perlin_detail::Grad2D(m_permutation[A], fx, fy);
+			const value_type p1 = perlin_detail::Grad2D(m_permutation[B], fx - 1, fy);
+			const value_type p2 = perlin_detail::Grad2D(m_permutation[A + 1], fx, fy - 1);
+			const value_type p3 = perlin_detail::Grad2D(m_permutation[B + 1], fx - 1, fy - 1);
+
+			const value_type q0 = perlin_detail::Lerp(p0, p1, u);
+			const value_type q1 = perlin_detail::Lerp(p2, p3, u);
+
+			return perlin_detail::Lerp(q0, q1, v);
+		}
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::noise3D(const value_type x, const value_type y, const value_type z) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Noise3D, 1);
+
+		if constexpr (Kernel == NoiseKernel::Simplex)
+		{
+			value_type result = 0;
+			perlin_detail::SimplexBlock3D<value_type, 1>(m_permutation.data(), &x, &y, &z, &result);
+			return result;
+		}
+		else
+		{
+			const value_type wx = perlin_detail::WrapCoordinate(x);
+			const value_type wy = perlin_detail::WrapCoordinate(y);
+			const value_type wz = perlin_detail::WrapCoordinate(z);
+
+			const value_type _x = perlin_detail::Floor(wx);
+			const value_type _y = perlin_detail::Floor(wy);
+			const value_type _z = perlin_detail::Floor(wz);
+
+			const std::int32_t ix = static_cast<std::int32_t>(_x) & 255;
+			const std::int32_t iy = static_cast<std::int32_t>(_y) & 255;
+			const std::int32_t iz = static_cast<std::int32_t>(_z) & 255;
+
+			const value_type fx = (wx - _x);
+			const value_type fy = (wy - _y);
+			const value_type fz = (wz - _z);
+
+			const value_type u = perlin_detail::Fade(fx);
+			const value_type v = perlin_detail::Fade(fy);
+			const value_type w = perlin_detail::Fade(fz);
+
+			const std::int32_t A = (m_permutation[ix] + iy);
+			const std::int32_t B = (m_permutation[ix + 1] + iy);
+
+			const std::int32_t AA = (m_permutation[A] + iz);
+			const std::int32_t AB = (m_permutation[A + 1] + iz);
+
+			const std::int32_t BA = (m_permutation[B] + iz);
+			const std::int32_t BB = (m_permutation[B + 1] + iz);
+
+			const value_type p0 = perlin_detail::Grad(m_permutation[AA], fx, fy, fz);
+			const value_type p1 = perlin_detail::Grad(m_permutation[BA], fx - 1, fy, fz);
+			const value_type p2 = perlin_detail::Grad(m_permutation[AB], fx, fy - 1, fz);
+			const value_type p3 = perlin_detail::Grad(m_permutation[BB], fx - 1, fy - 1, fz);
+			const value_type p4 = perlin_detail::Grad(m_permutation[AA + 1], fx, fy, fz - 1);
+			const value_type p5 = perlin_detail::Grad(m_permutation[BA + 1], fx - 1, fy, fz - 1);
+			const value_type p6 = perlin_detail::Grad(m_permutation[AB + 1], fx, fy - 1, fz - 1);
+			const value_type p7 = perlin_detail::Grad(m_permutation[BB + 1], fx - 1, fy - 1, fz - 1);
+
+			const value_type q0 = perlin_detail::Lerp(p0, p1, u);
+			const value_type q1 = perlin_detail::Lerp(p2, p3, u);
+			const value_type q2 = perlin_detail::Lerp(p4, p5, u);
+			const value_type q3 = perlin_detail::Lerp(p6, p7, u);
+
+			const value_type r0 = perlin_detail::Lerp(q0, q1, v);
+			const value_type r1 = perlin_detail::Lerp(q2, q3, v);
+
+			return perlin_detail::Lerp(r0, r1, w);
+		}
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::noise1D_01(const value_type x) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Noise1D_01, 1);
+
+		return perlin_detail::Remap_01(noise1D(x));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::noise2D_01(const value_type x, const value_type y) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Noise2D_01, 1);
+
+		return perlin_detail::Remap_01(noise2D(x, y));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::noise3D_01(const value_type x, const value_type y, const value_type z) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Noise3D_01, 1);
+
+		return perlin_detail::Remap_01(noise3D(x, y, z));
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::octave1D(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Octave1D, 1, octaves);
+
+		return perlin_detail::Octave1D<Kernel>(m_permutation.data(), x, octaves, persistence);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::octave2D(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Octave2D, 1, octaves);
+
+		return perlin_detail::Octave2D<Kernel>(m_permutation.data(), x, y, octaves, persistence);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::octave3D(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Octave3D, 1, octaves);
+
+		return perlin_detail::Octave3D<Kernel>(m_permutation.data(), x, y, z, octaves, persistence);
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::octave1D_11(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Octave1D_11, 1, octaves);
+
+		return perlin_detail::Clamp_11(octave1D(x, octaves, persistence));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::octave2D_11(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Octave2D_11, 1, octaves);
+
+		return perlin_detail::Clamp_11(octave2D(x, y, octaves, persistence));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::octave3D_11(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Octave3D_11, 1, octaves);
+
+		return perlin_detail::Clamp_11(octave3D(x, y, z, octaves, persistence));
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::octave1D_01(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Octave1D_01, 1, octaves);
+
+		return perlin_detail::RemapClamp_01(octave1D(x, octaves, persistence));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::octave2D_01(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Octave2D_01, 1, octaves);
+
+		return perlin_detail::RemapClamp_01(octave2D(x, y, octaves, persistence));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::octave3D_01(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::Octave3D_01, 1, octaves);
+
+		return perlin_detail::RemapClamp_01(octave3D(x, y, z, octaves, persistence));
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::normalizedOctave1D(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::NormalizedOctave1D, 1, octaves);
+
+		return (octave1D(x, octaves, persistence) / perlin_detail::MaxAmplitude(octaves, persistence));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::normalizedOctave2D(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::NormalizedOctave2D, 1, octaves);
+
+		return (octave2D(x, y, octaves, persistence) / perlin_detail::MaxAmplitude(octaves, persistence));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::normalizedOctave3D(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::NormalizedOctave3D, 1, octaves);
+
+		return (octave3D(x, y, z, octaves, persistence) / perlin_detail::MaxAmplitude(octaves, persistence));
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::normalizedOctave1D_01(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::NormalizedOctave1D_01, 1, octaves);
+
+		return perlin_detail::Remap_01(normalizedOctave1D(x, octaves, persistence));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::normalizedOctave2D_01(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::NormalizedOctave2D_01, 1, octaves);
+
+		return perlin_detail::Remap_01(normalizedOctave2D(x, y, octaves, persistence));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::normalizedOctave3D_01(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::NormalizedOctave3D_01, 1, octaves);
+
+		return perlin_detail::Remap_01(normalizedOctave3D(x, y, z, octaves, persistence));
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNoise2D(Output* dst, const grid_type& grid) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillNoise2D, (grid.width * grid.height));
+
+		perlin_detail::FillOctave<2, Kernel>(m_permutation.data(), dst, grid, 1, value_type(1), [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNoise3D(Output* dst, const grid_type& grid) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillNoise3D, (grid.width * grid.height * grid.depth));
+
+		perlin_detail::FillOctave<3, Kernel>(m_permutation.data(), dst, grid, 1, value_type(1), [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNoise2D_01(Output* dst, const grid_type& grid) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillNoise2D_01, (grid.width * grid.height));
+
+		perlin_detail::FillOctave<2, Kernel>(m_permutation.data(), dst, grid, 1, value_type(1), [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::Remap_01(x)); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNoise3D_01(Output* dst, const grid_type& grid) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillNoise3D_01, (grid.width * grid.height * grid.depth));
+
+		perlin_detail::FillOctave<3, Kernel>(m_permutation.data(), dst, grid, 1, value_type(1), [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::Remap_01(x)); });
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillOctave2D(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillOctave2D, (grid.width * grid.height), octaves);
+
+		perlin_detail::FillOctave<2, Kernel>(m_permutation.data(), dst, grid, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillOctave3D(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillOctave3D, (grid.width * grid.height * grid.depth), octaves);
+
+		perlin_detail::FillOctave<3, Kernel>(m_permutation.data(), dst, grid, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillOctave2D_11(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillOctave2D_11, (grid.width * grid.height), octaves);
+
+		perlin_detail::FillOctave<2, Kernel>(m_permutation.data(), dst, grid, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(perlin_detail::Clamp_11(x)); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillOctave3D_11(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillOctave3D_11, (grid.width * grid.height * grid.depth), octaves);
+
+		perlin_detail::FillOctave<3, Kernel>(m_permutation.data(), dst, grid, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(perlin_detail::Clamp_11(x)); });
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillOctave2D_01(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillOctave2D_01, (grid.width * grid.height), octaves);
+
+		perlin_detail::FillOctave<2, Kernel>(m_permutation.data(), dst, grid, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::RemapClamp_01(x)); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillOctave3D_01(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillOctave3D_01, (grid.width * grid.height * grid.depth), octaves);
+
+		perlin_detail::FillOctave<3, Kernel>(m_permutation.data(), dst, grid, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::RemapClamp_01(x)); });
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNormalizedOctave2D(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillNormalizedOctave2D, (grid.width * grid.height), octaves);
+
+		const value_type maxAmplitude = perlin_detail::MaxAmplitude(octaves, persistence);
+		perlin_detail::FillOctave<2, Kernel>(m_permutation.data(), dst, grid, octaves, persistence,
+			[maxAmplitude](const value_type x) { return perlin_detail::ConvertOutput<Output>(x / maxAmplitude); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNormalizedOctave3D(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillNormalizedOctave3D, (grid.width * grid.height * grid.depth), octaves);
+
+		const value_type maxAmplitude = perlin_detail::MaxAmplitude(octaves, persistence);
+		perlin_detail::FillOctave<3, Kernel>(m_permutation.data(), dst, grid, octaves, persistence,
+			[maxAmplitude](const value_type x) { return perlin_detail::ConvertOutput<Output>(x / maxAmplitude); });
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNormalizedOctave2D_01(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillNormalizedOctave2D_01, (grid.width * grid.height), octaves);
+
+		const value_type maxAmplitude = perlin_detail::MaxAmplitude(octaves, persistence);
+		perlin_detail::FillOctave<2, Kernel>(m_permutation.data(), dst, grid, octaves, persistence,
+			[maxAmplitude](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::Remap_01(x / maxAmplitude)); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNormalizedOctave3D_01(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		SIVPERLIN_INSTRUMENT(NoiseEntryPoint::FillNormalizedOctave3D_01, (grid.width * grid.height * grid.depth), octaves);
+
+		const value_type maxAmplitude = perlin_detail::MaxAmplitude(octaves, persistence);
+		perlin_detail::FillOctave<3, Kernel>(m_permutation.data(), dst, grid, octaves, persistence,
+			[maxAmplitude](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::Remap_01(x / maxAmplitude)); });
+	}
+
+	///////////////////////////////////////
+
+	template <class Float>
+	inline constexpr std::int32_t NoisePyramidOctaves(const BasicNoiseGrid<Float>& grid, const std::size_t level, const std::int32_t octaves) noexcept
+	{
+		Float spacing = std::max(((grid.stepX < 0) ? -grid.stepX : grid.stepX), ((grid.stepY < 0) ? -grid.stepY : grid.stepY));
+
+		if (spacing == 0)
+		{
+			return std::max(octaves, 0);
+		}
+
+		for (std::size_t i = 0; (i < level) && (spacing <= 1); ++i)
+		{
+			spacing *= 2;
+		}
+
+		// Octave o has a wavelength of 1 / 2^o
+		std::int32_t result = 0;
+
+		while ((result < octaves) && ((spacing * 2) <= 1))
+		{
+			spacing *= 2;
+			++result;
+		}
+
+		return std::min(std::max(result, 1), std::max(octaves, 0));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillOctave2DPyramid(Output* const* dst, const grid_type& grid, std::size_t levels, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		std::int32_t levelOctaves[64] = {};
+		levels = std::min<std::size_t>(levels, 64);
+
+		for (std::size_t level = 0; level < levels; ++level)
+		{
+			levelOctaves[level] = NoisePyramidOctaves(grid, level, octaves);
+		}
+
+		perlin_detail::FillOctavePyramid<Kernel>(m_permutation.data(), dst, grid, levels, levelOctaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::derivative2D_type BasicPerlinNoise<Float, Kernel>::noise2DDerivative(const value_type x, const value_type y) const noexcept
+	{
+		const value_type z = static_cast<value_type>(SIVPERLIN_DEFAULT_Z);
+		derivative3D_type result;
+		perlin_detail::NoiseDerivativeBlock<2, Kernel, value_type, 1>(m_permutation.data(), &x, &y, &z, &result);
+		return perlin_detail::ToDerivative2D(result);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::derivative3D_type BasicPerlinNoise<Float, Kernel>::noise3DDerivative(const value_type x, const value_type y, const value_type z) const noexcept
+	{
+		derivative3D_type result;
+		perlin_detail::NoiseDerivativeBlock<3, Kernel, value_type, 1>(m_permutation.data(), &x, &y, &z, &result);
+		return result;
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::derivative2D_type BasicPerlinNoise<Float, Kernel>::octave2DDerivative(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		return perlin_detail::ToDerivative2D(perlin_detail::OctaveDerivative<2, Kernel>(m_permutation.data(), x, y, static_cast<value_type>(SIVPERLIN_DEFAULT_Z), octaves, persistence));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::derivative3D_type BasicPerlinNoise<Float, Kernel>::octave3DDerivative(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		return perlin_detail::OctaveDerivative<3, Kernel>(m_permutation.data(), x, y, z, octaves, persistence);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNoise2DDerivative(derivative2D_type* dst, const grid_type& grid) const noexcept
+	{
+		perlin_detail::FillOctaveDerivative<2, Kernel>(m_permutation.data(), dst, grid, 1, value_type(1));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillNoise3DDerivative(derivative3D_type* dst, const grid_type& grid) const noexcept
+	{
+		perlin_detail::FillOctaveDerivative<3, Kernel>(m_permutation.data(), dst, grid, 1, value_type(1));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillOctave2DDerivative(derivative2D_type* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillOctaveDerivative<2, Kernel>(m_permutation.data(), dst, grid, octaves, persistence);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillOctave3DDerivative(derivative3D_type* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillOctaveDerivative<3, Kernel>(m_permutation.data(), dst, grid, octaves, persistence);
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::warpedOctave2D(const value_type x, const value_type y, const warp_type& warp, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		return perlin_detail::WarpedOctave<2, Kernel>(m_permutation.data(), x, y, static_cast<value_type>(SIVPERLIN_DEFAULT_Z), warp, octaves, persistence);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::warpedOctave3D(const value_type x, const value_type y, const value_type z, const warp_type& warp, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		return perlin_detail::WarpedOctave<3, Kernel>(m_permutation.data(), x, y, z, warp, octaves, persistence);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillWarpedOctave2D(Output* dst, const grid_type& grid, const warp_type& warp, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillWarpedOctave<2, Kernel>(m_permutation.data(), dst, grid, warp, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillWarpedOctave3D(Output* dst, const grid_type& grid, const warp_type& warp, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillWarpedOctave<3, Kernel>(m_permutation.data(), dst, grid, warp, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillWarpedOctave2D_01(Output* dst, const grid_type& grid, const warp_type& warp, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillWarpedOctave<2, Kernel>(m_permutation.data(), dst, grid, warp, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::RemapClamp_01(x)); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillWarpedOctave3D_01(Output* dst, const grid_type& grid, const warp_type& warp, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillWarpedOctave<3, Kernel>(m_permutation.data(), dst, grid, warp, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::RemapClamp_01(x)); });
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::periodicNoise1D(const value_type x, const std::int32_t periodX) const noexcept
+	{
+		return periodicOctave1D(x, periodX, 1, value_type(1));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::periodicNoise2D(const value_type x, const value_type y, const std::int32_t periodX, const std::int32_t periodY) const noexcept
+	{
+		return periodicOctave2D(x, y, periodX, periodY, 1, value_type(1));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::periodicNoise3D(const value_type x, const value_type y, const value_type z, const std::int32_t periodX, const std::int32_t periodY, const std::int32_t periodZ) const noexcept
+	{
+		return periodicOctave3D(x, y, z, periodX, periodY, periodZ, 1, value_type(1));
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::periodicOctave1D(const value_type x, const std::int32_t periodX, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		const value_type xs[1] = { x }, ys[1] = { static_cast<value_type>(SIVPERLIN_DEFAULT_Y) }, zs[1] = { static_cast<value_type>(SIVPERLIN_DEFAULT_Z) };
+		const std::int32_t periods[3] = { periodX, 256, 256 };
+		value_type result[1];
+		perlin_detail::PeriodicOctaveBlock<1, Kernel, value_type, 1>(m_permutation.data(), xs, ys, zs, periods, octaves, persistence, result);
+		return result[0];
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::periodicOctave2D(const value_type x, const value_type y, const std::int32_t periodX, const std::int32_t periodY, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		const value_type xs[1] = { x }, ys[1] = { y }, zs[1] = { static_cast<value_type>(SIVPERLIN_DEFAULT_Z) };
+		const std::int32_t periods[3] = { periodX, periodY, 256 };
+		value_type result[1];
+		perlin_detail::PeriodicOctaveBlock<2, Kernel, value_type, 1>(m_permutation.data(), xs, ys, zs, periods, octaves, persistence, result);
+		return result[0];
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicPerlinNoise<Float, Kernel>::value_type BasicPerlinNoise<Float, Kernel>::periodicOctave3D(const value_type x, const value_type y, const value_type z, const std::int32_t periodX, const std::int32_t periodY, const std::int32_t periodZ, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		const value_type xs[1] = { x }, ys[1] = { y }, zs[1] = { z };
+		const std::int32_t periods[3] = { periodX, periodY, periodZ };
+		value_type result[1];
+		perlin_detail::PeriodicOctaveBlock<3, Kernel, value_type, 1>(m_permutation.data(), xs, ys, zs, periods, octaves, persistence, result);
+		return result[0];
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillPeriodicOctave2D(Output* dst, const grid_type& grid, const std::int32_t periodX, const std::int32_t periodY, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillPeriodicOctave<2, Kernel>(m_permutation.data(), dst, grid, { periodX, periodY, 256 }, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillPeriodicOctave3D(Output* dst, const grid_type& grid, const std::int32_t periodX, const std::int32_t periodY, const std::int32_t periodZ, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillPeriodicOctave<3, Kernel>(m_permutation.data(), dst, grid, { periodX, periodY, periodZ }, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillPeriodicOctave2D_01(Output* dst, const grid_type& grid, const std::int32_t periodX, const std::int32_t periodY, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillPeriodicOctave<2, Kernel>(m_permutation.data(), dst, grid, { periodX, periodY, 256 }, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::RemapClamp_01(x)); });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicPerlinNoise<Float, Kernel>::fillPeriodicOctave3D_01(Output* dst, const grid_type& grid, const std::int32_t periodX, const std::int32_t periodY, const std::int32_t periodZ, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::FillPeriodicOctave<3, Kernel>(m_permutation.data(), dst, grid, { periodX, periodY, periodZ }, octaves, persistence, [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::RemapClamp_01(x)); });
+	}
+
+	///////////////////////////////////////
+
+	inline NoiseThreadPool::NoiseThreadPool(const std::size_t threadCount)
+	{
+		const std::size_t n = (threadCount ? threadCount : std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+
+		m_ranges = std::make_unique<Range[]>(n);
+
+		m_threads.reserve(n);
+
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			m_threads.emplace_back(&NoiseThreadPool::run, this, i);
+		}
+	}
+
+	inline NoiseThreadPool::~NoiseThreadPool()
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stop = true;
+		}
+
+		m_wake.notify_all();
+
+		for (auto& thread : m_threads)
+		{
+			thread.join();
+		}
+	}
+
+	inline std::size_t NoiseThreadPool::threadCount() const noexcept
+	{
+		return m_threads.size();
+	}
+
+	template <class Task>
+	inline void NoiseThreadPool::parallelFor(const std::size_t count, Task&& task)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		std::lock_guard jobLock{ m_jobMutex };
+
+		const std::size_t n = m_threads.size();
+
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			std::lock_guard lock{ m_ranges[i].mutex };
+			m_ranges[i].begin = (count * i / n);
+			m_ranges[i].end = (count * (i + 1) / n);
+		}
+
+		using task_type = std::remove_reference_t<Task>;
+
+		{
+			std::lock_guard lock{ m_mutex };
+			m_invoke = [](void* f, const std::size_t index) { (*static_cast<task_type*>(f))(index); };
+			m_task = const_cast<void*>(static_cast<const void*>(std::addressof(task)));
+			m_active = n;
+			++m_generation;
+		}
+
+		m_wake.notify_all();
+
+		std::unique_lock lock{ m_mutex };
+		m_done.wait(lock, [this] { return (m_active == 0); });
+	}
+
+	inline void NoiseThreadPool::run(const std::size_t worker)
+	{
+		std::uint64_t generation = 0;
+
+		for (;;)
+		{
+			{
+				std::unique_lock lock{ m_mutex };
+				m_wake.wait(lock, [&] { return (m_stop || (m_generation != generation)); });
+
+				if (m_stop)
+				{
+					return;
+				}
+
+				generation = m_generation;
+			}
+
+			std::size_t index;
+
+			while (next(worker, index))
+			{
+				m_invoke(m_task, index);
+			}
+
+			{
+				std::lock_guard lock{ m_mutex };
+
+				if (--m_active == 0)
+				{
+					m_done.notify_one();
+				}
+			}
+		}
+	}
+
+	inline bool NoiseThreadPool::next(const std::size_t worker, std::size_t& index)
+	{
+		Range& own = m_ranges[worker];
+
+		{
+			std::lock_guard lock{ own.mutex };
+
+			if (own.begin < own.end)
+			{
+				index = own.begin++;
+				return true;
+			}
+		}
+
+		const std::size_t n = m_threads.size();
+
+		for (std::size_t i = 1; i < n; ++i)
+		{
+			Range& victim = m_ranges[(worker + i) % n];
+			std::size_t begin, end;
+
+			{
+				std::lock_guard lock{ victim.mutex };
+
+				if (victim.end <= victim.begin)
+				{
+					continue;
+				}
+
+				end = victim.end;
+				begin = (end - (end - victim.begin + 1) / 2);
+				victim.end = begin;
+			}
+
+			std::lock_guard lock{ own.mutex };
+			own.begin = (begin + 1);
+			own.end = end;
+			index = begin;
+			return true;
+		}
+
+		return false;
+	}
+
+	template <class Output, class Float, class Fill>
+	inline void ParallelFill(NoiseThreadPool& pool, Output* dst, const BasicNoiseGrid<Float>& grid, Fill&& fill)
+	{
+		if ((grid.width == 0) || (grid.height == 0) || (grid.depth == 0))
+		{
+			return;
+		}
+
+		const std::size_t rowBytes = (grid.width * sizeof(Output));
+		const std::size_t rowsPerTile = std::clamp<std::size_t>((SIVPERLIN_TILE_BYTES / rowBytes), 1, grid.height);
+		const std::size_t tilesPerSlice = ((grid.height + rowsPerTile - 1) / rowsPerTile);
+
+		pool.parallelFor((tilesPerSlice * grid.depth), [&](const std::size_t tile)
+		{
+			const std::size_t k = (tile / tilesPerSlice);
+			const std::size_t j = ((tile % tilesPerSlice) * rowsPerTile);
+
+			BasicNoiseGrid<Float> subGrid = grid;
+			subGrid.height = std::min(rowsPerTile, (grid.height - j));
+			subGrid.depth = 1;
+			subGrid.offsetY = (grid.offsetY + static_cast<std::int64_t>(j));
+			subGrid.offsetZ = (grid.offsetZ + static_cast<std::int64_t>(k));
+
+			fill((dst + (k * grid.height + j) * grid.width), subGrid);
+		});
+	}
+
+	template <class Output, class Float, class Fill>
+	inline void ParallelFill(Output* dst, const BasicNoiseGrid<Float>& grid, Fill&& fill, const std::size_t threadCount)
+	{
+		NoiseThreadPool pool{ threadCount };
+
+		ParallelFill(pool, dst, grid, std::forward<Fill>(fill));
+	}
+
+	///////////////////////////////////////
+
+	template <class Float, NoiseKernel Kernel>
+	inline BasicNoiseTileCache<Float, Kernel>::BasicNoiseTileCache(const std::size_t tileSize, const value_type step, const std::size_t capacity)
+		: m_tileSize{ tileSize }
+		, m_step{ step }
+		, m_capacity{ std::max<std::size_t>(capacity, 1) } {}
+
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseTileCache<Float, Kernel>::tile_type BasicNoiseTileCache<Float, Kernel>::octave2D(const noise_type& noise,
+		const std::int64_t tx, const std::int64_t ty, const std::int32_t octaves, const value_type persistence)
+	{
+		return get(noise, Key{ noise.serialize(), tx, ty, 0, 2, octaves, persistence });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseTileCache<Float, Kernel>::tile_type BasicNoiseTileCache<Float, Kernel>::octave3D(const noise_type& noise,
+		const std::int64_t tx, const std::int64_t ty, const std::int64_t tz, const std::int32_t octaves, const value_type persistence)
+	{
+		return get(noise, Key{ noise.serialize(), tx, ty, tz, 3, octaves, persistence });
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseTileCache<Float, Kernel>::Statistics BasicNoiseTileCache<Float, Kernel>::statistics() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		Statistics result = m_statistics;
+		result.size = m_entries.size();
+		return result;
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline void BasicNoiseTileCache<Float, Kernel>::clear()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_entries.clear();
+		m_order.clear();
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline std::size_t BasicNoiseTileCache<Float, Kernel>::tileSize() const noexcept
+	{
+		return m_tileSize;
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseTileCache<Float, Kernel>::value_type BasicNoiseTileCache<Float, Kernel>::step() const noexcept
+	{
+		return m_step;
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline std::size_t BasicNoiseTileCache<Float, Kernel>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline std::size_t BasicNoiseTileCache<Float, Kernel>::KeyHash::operator ()(const Key& key) const noexcept
+	{
+		// FNV-1a
+		std::uint64_t h = 14695981039346656037ull;
+
+		const auto add = [&h](const void* data, const std::size_t size)
+		{
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				h = ((h ^ bytes[i]) * 1099511628211ull);
+			}
+		};
 
-			return result;
+		add(key.state.data(), key.state.size());
+		add(&key.tx, sizeof(key.tx));
+		add(&key.ty, sizeof(key.ty));
+		add(&key.tz, sizeof(key.tz));
+		add(&key.dimension, sizeof(key.dimension));
+		add(&key.octaves, sizeof(key.octaves));
+		add(&key.persistence, sizeof(key.persistence));
+
+		return static_cast<std::size_t>(h);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseTileCache<Float, Kernel>::tile_type BasicNoiseTileCache<Float, Kernel>::get(const noise_type& noise, const Key& key)
+	{
+		std::promise<tile_type> promise;
+		std::shared_future<tile_type> future;
+		std::uint64_t id = 0;
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			if (auto it = m_entries.find(key); it != m_entries.end())
+			{
+				++m_statistics.hits;
+				m_order.splice(m_order.begin(), m_order, it->second.position);
+				future = it->second.tile;
+			}
+			else
+			{
+				++m_statistics.misses;
+				id = ++m_nextID;
+				m_order.push_front(key);
+				m_entries.emplace(key, Entry{ promise.get_future().share(), m_order.begin(), id });
+
+				while (m_capacity < m_entries.size())
+				{
+					m_entries.erase(m_order.back());
+					m_order.pop_back();
+					++m_statistics.evictions;
+				}
+			}
 		}
 
-		template <class Float>
-		[[nodiscard]]
-		inline constexpr Float MaxAmplitude(const std::int32_t octaves, const Float persistence) noexcept
+		if (id == 0)
 		{
-			using value_type = Float;
-			value_type result = 0;
-			value_type amplitude = 1;
+			return future.get();
+		}
 
-			for (std::int32_t i = 0; i < octaves; ++i)
+		try
+		{
+			const std::size_t depth = ((key.dimension == 3) ? m_tileSize : 1);
+			auto tile = std::make_shared<std::vector<Float>>(m_tileSize * m_tileSize * depth);
+
+			const value_type size = static_cast<value_type>(static_cast<std::int64_t>(m_tileSize));
+			const BasicNoiseGrid<Float> grid{
+				static_cast<value_type>(key.tx) * size * m_step,
+				static_cast<value_type>(key.ty) * size * m_step,
+				static_cast<value_type>(key.tz) * size * m_step,
+				m_step, m_step, m_step, m_tileSize, m_tileSize, depth };
+
+			if (key.dimension == 3)
 			{
-				result += amplitude;
-				amplitude *= persistence;
+				noise.fillOctave3D(tile->data(), grid, key.octaves, key.persistence);
+			}
+			else
+			{
+				noise.fillOctave2D(tile->data(), grid, key.octaves, key.persistence);
 			}
 
-			return result;
+			promise.set_value(tile);
+			return tile;
+		}
+		catch (...)
+		{
+			{
+				std::lock_guard lock{ m_mutex };
+
+				// Lets the next request try again
+				if (auto it = m_entries.find(key); (it != m_entries.end()) && (it->second.id == id))
+				{
+					m_order.erase(it->second.position);
+					m_entries.erase(it);
+				}
+			}
+
+			promise.set_exception(std::current_exception());
+			throw;
 		}
 	}
 
 	///////////////////////////////////////
 
-	template <class Float>
-	inline constexpr BasicPerlinNoise<Float>::BasicPerlinNoise() noexcept
-		: m_permutation{ 151,160,137,91,90,15,
-				131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,8,99,37,240,21,10,23,
-				190, 6,148,247,120,234,75,0,26,197,62,94,252,219,203,117,35,11,32,57,177,33,
-				88,237,149,56,87,174,20,125,136,171,168, 68,175,74,165,71,134,139,48,27,166,
-				77,146,158,231,83,111,229,122,60,211,133,230,220,105,92,41,55,46,245,40,244,
-				102,143,54, 65,25,63,161, 1,216,80,73,209,76,132,187,208, 89,18,169,200,196,
-				135,130,116,188,159,86,164,100,109,198,173,186, 3,64,52,217,226,250,124,123,
-				5,202,38,147,118,126,255,82,85,212,207,206,59,227,47,16,58,17,182,189,28,42,
-				223,183,170,213,119,248,152, 2,44,154,163, 70,221,153,101,155,167, 43,172,9,
-				129,22,39,253, 19,98,108,110,79,113,224,232,178,185, 112,104,218,246,97,228,
-				251,34,242,193,238,210,144,12,191,179,162,241, 81,51,145,235,249,14,239,107,
-				49,192,214, 31,181,199,106,157,184, 84,204,176,115,121,50,45,127, 4,150,254,
-				138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180 } {}
+	template <class Float, NoiseKernel Kernel>
+	inline BasicNoiseChunkGenerator<Float, Kernel>::Request::Request(std::shared_ptr<Job> job, std::shared_future<chunk_type> future) noexcept
+		: m_job{ std::move(job) }
+		, m_future{ std::move(future) } {}
 
-	template <class Float>
-	inline BasicPerlinNoise<Float>::BasicPerlinNoise(const seed_type seed)
+	template <class Float, NoiseKernel Kernel>
+	inline const std::shared_future<typename BasicNoiseChunkGenerator<Float, Kernel>::chunk_type>& BasicNoiseChunkGenerator<Float, Kernel>::Request::future() const noexcept
 	{
-		reseed(seed);
+		return m_future;
 	}
 
-	template <class Float>
-	SIVPERLIN_CONCEPT_URBG_
-	inline BasicPerlinNoise<Float>::BasicPerlinNoise(URBG&& urbg)
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseChunkGenerator<Float, Kernel>::Status BasicNoiseChunkGenerator<Float, Kernel>::Request::status() const noexcept
 	{
-		reseed(std::forward<URBG>(urbg));
+		if (not m_job)
+		{
+			return Status::Cancelled;
+		}
+
+		return m_job->status.load(std::memory_order_acquire);
 	}
 
-	///////////////////////////////////////
+	template <class Float, NoiseKernel Kernel>
+	inline bool BasicNoiseChunkGenerator<Float, Kernel>::Request::cancel() noexcept
+	{
+		if (not m_job)
+		{
+			return false;
+		}
 
-	template <class Float>
-	inline void BasicPerlinNoise<Float>::reseed(const seed_type seed)
+		return Cancel(*m_job);
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline bool BasicNoiseChunkGenerator<Float, Kernel>::Request::valid() const noexcept
 	{
-		reseed(default_random_engine{ seed });
+		return static_cast<bool>(m_job);
 	}
 
-	template <class Float>
-	SIVPERLIN_CONCEPT_URBG_
-	inline void BasicPerlinNoise<Float>::reseed(URBG&& urbg)
+	template <class Float, NoiseKernel Kernel>
+	inline BasicNoiseChunkGenerator<Float, Kernel>::BasicNoiseChunkGenerator(const noise_type& noise, const std::size_t threadCount)
+		: m_noise{ noise }
 	{
-		std::iota(m_permutation.begin(), m_permutation.end(), uint8_t{ 0 });
+		const std::size_t n = (threadCount ? threadCount : std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
 
-		perlin_detail::Shuffle(m_permutation.begin(), m_permutation.end(), std::forward<URBG>(urbg));
+		m_threads.reserve(n);
+
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			m_threads.emplace_back(&BasicNoiseChunkGenerator::run, this);
+		}
 	}
 
-	///////////////////////////////////////
+	template <class Float, NoiseKernel Kernel>
+	inline BasicNoiseChunkGenerator<Float, Kernel>::~BasicNoiseChunkGenerator()
+	{
+		cancelAll();
 
-	template <class Float>
-	inline constexpr const typename BasicPerlinNoise<Float>::state_type& BasicPerlinNoise<Float>::serialize() const noexcept
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stop = true;
+		}
+
+		m_wake.notify_all();
+
+		for (auto& thread : m_threads)
+		{
+			thread.join();
+		}
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseChunkGenerator<Float, Kernel>::Request BasicNoiseChunkGenerator<Float, Kernel>::octave2D(const grid_type& grid,
+		const std::int32_t octaves, const value_type persistence, const std::int32_t priority)
 	{
-		return m_permutation;
+		grid_type slice = grid;
+		slice.depth = 1;
+		return submit(slice, 2, octaves, persistence, priority);
 	}
 
-	template <class Float>
-	inline constexpr void BasicPerlinNoise<Float>::deserialize(const state_type& state) noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseChunkGenerator<Float, Kernel>::Request BasicNoiseChunkGenerator<Float, Kernel>::octave3D(const grid_type& grid,
+		const std::int32_t octaves, const value_type persistence, const std::int32_t priority)
 	{
-		m_permutation = state;
+		return submit(grid, 3, octaves, persistence, priority);
 	}
 
-	///////////////////////////////////////
+	template <class Float, NoiseKernel Kernel>
+	inline void BasicNoiseChunkGenerator<Float, Kernel>::cancelAll()
+	{
+		std::priority_queue<QueueEntry> queue;
+		std::vector<std::shared_ptr<Job>> running;
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::noise1D(const value_type x) const noexcept
+		{
+			std::lock_guard lock{ m_mutex };
+			std::swap(queue, m_queue);
+			running = m_running;
+		}
+
+		for (; not queue.empty(); queue.pop())
+		{
+			Cancel(*queue.top().job);
+		}
+
+		for (const auto& job : running)
+		{
+			Cancel(*job);
+		}
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline std::size_t BasicNoiseChunkGenerator<Float, Kernel>::threadCount() const noexcept
 	{
-		return noise3D(x,
-			static_cast<value_type>(SIVPERLIN_DEFAULT_Y),
-			static_cast<value_type>(SIVPERLIN_DEFAULT_Z));
+		return m_threads.size();
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::noise2D(const value_type x, const value_type y) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline const typename BasicNoiseChunkGenerator<Float, Kernel>::noise_type& BasicNoiseChunkGenerator<Float, Kernel>::noise() const noexcept
 	{
-		return noise3D(x,
-			y,
-			static_cast<value_type>(SIVPERLIN_DEFAULT_Z));
+		return m_noise;
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::noise3D(const value_type x, const value_type y, const value_type z) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseChunkGenerator<Float, Kernel>::Request BasicNoiseChunkGenerator<Float, Kernel>::submit(const grid_type& grid,
+		const std::int32_t dimension, const std::int32_t octaves, const value_type persistence, const std::int32_t priority)
+	{
+		auto job = std::make_shared<Job>();
+		job->grid = grid;
+		job->dimension = dimension;
+		job->octaves = octaves;
+		job->persistence = persistence;
+
+		Request request{ job, job->promise.get_future().share() };
+
+		{
+			std::lock_guard lock{ m_mutex };
+			m_queue.push(QueueEntry{ priority, m_nextSequence++, std::move(job) });
+		}
+
+		m_wake.notify_one();
+
+		return request;
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline void BasicNoiseChunkGenerator<Float, Kernel>::run()
 	{
-		const value_type _x = std::floor(x);
-		const value_type _y = std::floor(y);
-		const value_type _z = std::floor(z);
+		for (;;)
+		{
+			std::shared_ptr<Job> job;
+
+			{
+				std::unique_lock lock{ m_mutex };
+				m_wake.wait(lock, [this] { return (m_stop || (not m_queue.empty())); });
 
-		const std::int32_t ix = static_cast<std::int32_t>(_x) & 255;
-		const std::int32_t iy = static_cast<std::int32_t>(_y) & 255;
-		const std::int32_t iz = static_cast<std::int32_t>(_z) & 255;
+				if (m_queue.empty())
+				{
+					return;
+				}
 
-		const value_type fx = (x - _x);
-		const value_type fy = (y - _y);
-		const value_type fz = (z - _z);
+				job = m_queue.top().job;
+				m_queue.pop();
 
-		const value_type u = perlin_detail::Fade(fx);
-		const value_type v = perlin_detail::Fade(fy);
-		const value_type w = perlin_detail::Fade(fz);
+				// A cancelled job has already been resolved
+				Status expected = Status::Pending;
 
-		const std::uint8_t A = (m_permutation[ix & 255] + iy) & 255;
-		const std::uint8_t B = (m_permutation[(ix + 1) & 255] + iy) & 255;
+				if (not job->status.compare_exchange_strong(expected, Status::Running, std::memory_order_acq_rel))
+				{
+					continue;
+				}
 
-		const std::uint8_t AA = (m_permutation[A] + iz) & 255;
-		const std::uint8_t AB = (m_permutation[(A + 1) & 255] + iz) & 255;
+				m_running.push_back(job);
+			}
+
+			chunk_type chunk;
+
+			try
+			{
+				auto samples = std::make_shared<std::vector<Float>>(job->grid.width * job->grid.height * job->grid.depth);
+
+				if (generate(*job, *samples))
+				{
+					chunk = std::move(samples);
+				}
+
+				Status expected = Status::Running;
+
+				if (not job->status.compare_exchange_strong(expected, Status::Ready, std::memory_order_acq_rel))
+				{
+					chunk = nullptr;
+				}
+
+				job->promise.set_value(std::move(chunk));
+			}
+			catch (...)
+			{
+				Status expected = Status::Running;
+				job->status.compare_exchange_strong(expected, Status::Ready, std::memory_order_acq_rel);
+				job->promise.set_exception(std::current_exception());
+			}
+
+			{
+				std::lock_guard lock{ m_mutex };
+				m_running.erase(std::find(m_running.begin(), m_running.end(), job));
+			}
+		}
+	}
 
-		const std::uint8_t BA = (m_permutation[B] + iz) & 255;
-		const std::uint8_t BB = (m_permutation[(B + 1) & 255] + iz) & 255;
+	template <class Float, NoiseKernel Kernel>
+	inline bool BasicNoiseChunkGenerator<Float, Kernel>::generate(Job& job, std::vector<Float>& samples) const noexcept
+	{
+		const grid_type& grid = job.grid;
+
+		if ((grid.width == 0) || (grid.height == 0) || (grid.depth == 0))
+		{
+			return true;
+		}
+
+		// Bands of rows like ParallelFill(), so that the result is the same as one fill of the whole grid
+		const std::size_t rowsPerBand = std::clamp<std::size_t>((SIVPERLIN_TILE_BYTES / (grid.width * sizeof(Float))), 1, grid.height);
+
+		for (std::size_t k = 0; k < grid.depth; ++k)
+		{
+			for (std::size_t j = 0; j < grid.height; j += rowsPerBand)
+			{
+				if (job.status.load(std::memory_order_acquire) != Status::Running)
+				{
+					return false;
+				}
+
+				grid_type band = grid;
+				band.height = std::min(rowsPerBand, (grid.height - j));
+				band.depth = 1;
+				band.offsetY = (grid.offsetY + static_cast<std::int64_t>(j));
+				band.offsetZ = (grid.offsetZ + static_cast<std::int64_t>(k));
+
+				Float* dst = (samples.data() + (k * grid.height + j) * grid.width);
+
+				if (job.dimension == 3)
+				{
+					m_noise.fillOctave3D(dst, band, job.octaves, job.persistence);
+				}
+				else
+				{
+					m_noise.fillOctave2D(dst, band, job.octaves, job.persistence);
+				}
+			}
+		}
 
-		const value_type p0 = perlin_detail::Grad(m_permutation[AA], fx, fy, fz);
-		const value_type p1 = perlin_detail::Grad(m_permutation[BA], fx - 1, fy, fz);
-		const value_type p2 = perlin_detail::Grad(m_permutation[AB], fx, fy - 1, fz);
-		const value_type p3 = perlin_detail::Grad(m_permutation[BB], fx - 1, fy - 1, fz);
-		const value_type p4 = perlin_detail::Grad(m_permutation[(AA + 1) & 255], fx, fy, fz - 1);
-		const value_type p5 = perlin_detail::Grad(m_permutation[(BA + 1) & 255], fx - 1, fy, fz - 1);
-		const value_type p6 = perlin_detail::Grad(m_permutation[(AB + 1) & 255], fx, fy - 1, fz - 1);
-		const value_type p7 = perlin_detail::Grad(m_permutation[(BB + 1) & 255], fx - 1, fy - 1, fz - 1);
+		return true;
+	}
 
-		const value_type q0 = perlin_detail::Lerp(p0, p1, u);
-		const value_type q1 = perlin_detail::Lerp(p2, p3, u);
-		const value_type q2 = perlin_detail::Lerp(p4, p5, u);
-		const value_type q3 = perlin_detail::Lerp(p6, p7, u);
+	template <class Float, NoiseKernel Kernel>
+	inline bool BasicNoiseChunkGenerator<Float, Kernel>::Cancel(Job& job) noexcept
+	{
+		Status expected = Status::Pending;
 
-		const value_type r0 = perlin_detail::Lerp(q0, q1, v);
-		const value_type r1 = perlin_detail::Lerp(q2, q3, v);
+		if (job.status.compare_exchange_strong(expected, Status::Cancelled, std::memory_order_acq_rel))
+		{
+			job.promise.set_value(nullptr);
+			return true;
+		}
 
-		return perlin_detail::Lerp(r0, r1, w);
+		expected = Status::Running;
+		return job.status.compare_exchange_strong(expected, Status::Cancelled, std::memory_order_acq_rel);
 	}
 
 	///////////////////////////////////////
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::noise1D_01(const value_type x) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline BasicNoiseWindow<Float, Kernel>::BasicNoiseWindow(const noise_type& noise, const grid_type& grid, const std::int32_t octaves, const value_type persistence)
+		: m_noise{ noise }
+		, m_grid{ grid }
+		, m_octaves{ octaves }
+		, m_persistence{ persistence }
+		, m_data(grid.width * grid.height)
 	{
-		return perlin_detail::Remap_01(noise1D(x));
+		m_grid.depth = 1;
+		m_noise.fillOctave2D(m_data.data(), m_grid, m_octaves, m_persistence);
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::noise2D_01(const value_type x, const value_type y) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline void BasicNoiseWindow<Float, Kernel>::scroll(const std::int64_t dx, const std::int64_t dy)
 	{
-		return perlin_detail::Remap_01(noise2D(x, y));
+		const std::int64_t width = static_cast<std::int64_t>(m_grid.width);
+		const std::int64_t height = static_cast<std::int64_t>(m_grid.height);
+
+		m_grid.offsetX += dx;
+		m_grid.offsetY += dy;
+
+		if ((width == 0) || (height == 0))
+		{
+			return;
+		}
+
+		if ((width <= std::abs(dx)) || (height <= std::abs(dy)))
+		{
+			m_column = m_row = 0;
+			m_noise.fillOctave2D(m_data.data(), m_grid, m_octaves, m_persistence);
+			return;
+		}
+
+		m_column = static_cast<std::size_t>(((static_cast<std::int64_t>(m_column) + dx) % width + width) % width);
+		m_row = static_cast<std::size_t>(((static_cast<std::int64_t>(m_row) + dy) % height + height) % height);
+
+		// Newly visible rows and columns of the window
+		const std::size_t rowBegin = static_cast<std::size_t>((0 < dy) ? (height - dy) : 0);
+		const std::size_t rowEnd = static_cast<std::size_t>((0 < dy) ? height : -dy);
+		const std::size_t columnBegin = static_cast<std::size_t>((0 < dx) ? (width - dx) : 0);
+		const std::size_t columnEnd = static_cast<std::size_t>((0 < dx) ? width : -dx);
+
+		for (std::size_t j = 0; j < m_grid.height; ++j)
+		{
+			if ((rowBegin <= j) && (j < rowEnd))
+			{
+				update(j, 0, m_grid.width);
+			}
+			else if (columnBegin < columnEnd)
+			{
+				update(j, columnBegin, columnEnd);
+			}
+		}
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::noise3D_01(const value_type x, const value_type y, const value_type z) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline void BasicNoiseWindow<Float, Kernel>::moveTo(const std::int64_t offsetX, const std::int64_t offsetY)
 	{
-		return perlin_detail::Remap_01(noise3D(x, y, z));
+		scroll((offsetX - m_grid.offsetX), (offsetY - m_grid.offsetY));
 	}
 
-	///////////////////////////////////////
+	template <class Float, NoiseKernel Kernel>
+	inline const typename BasicNoiseWindow<Float, Kernel>::grid_type& BasicNoiseWindow<Float, Kernel>::grid() const noexcept
+	{
+		return m_grid;
+	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::octave1D(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline typename BasicNoiseWindow<Float, Kernel>::value_type BasicNoiseWindow<Float, Kernel>::operator ()(const std::size_t i, const std::size_t j) const noexcept
 	{
-		return perlin_detail::Octave1D(*this, x, octaves, persistence);
+		const std::size_t column = ((m_column + i) % m_grid.width);
+		const std::size_t row = ((m_row + j) % m_grid.height);
+		return m_data[row * m_grid.width + column];
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::octave2D(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline std::array<typename BasicNoiseWindow<Float, Kernel>::View, 4> BasicNoiseWindow<Float, Kernel>::views() const noexcept
 	{
-		return perlin_detail::Octave2D(*this, x, y, octaves, persistence);
+		// Window columns [0, w0) are stored at [m_column, width), and [w0, width) at [0, m_column). Likewise for rows.
+		const std::size_t w0 = (m_grid.width - m_column);
+		const std::size_t h0 = (m_grid.height - m_row);
+		const value_type* data = m_data.data();
+		const std::size_t stride = m_grid.width;
+
+		return{ {
+			{ (data + m_row * stride + m_column), 0, 0, w0, h0 },
+			{ (data + m_row * stride), w0, 0, m_column, h0 },
+			{ (data + m_column), 0, h0, w0, m_row },
+			{ data, w0, h0, m_column, m_row },
+		} };
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::octave3D(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline std::size_t BasicNoiseWindow<Float, Kernel>::stride() const noexcept
+	{
+		return m_grid.width;
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline void BasicNoiseWindow<Float, Kernel>::copyTo(value_type* dst) const noexcept
+	{
+		for (const View& view : views())
+		{
+			for (std::size_t j = 0; j < view.height; ++j)
+			{
+				std::copy_n((view.data + j * stride()), view.width, (dst + (view.y + j) * m_grid.width + view.x));
+			}
+		}
+	}
+
+	template <class Float, NoiseKernel Kernel>
+	inline void BasicNoiseWindow<Float, Kernel>::update(const std::size_t j, const std::size_t begin, const std::size_t end) noexcept
 	{
-		return perlin_detail::Octave3D(*this, x, y, z, octaves, persistence);
+		value_type* row = (m_data.data() + ((m_row + j) % m_grid.height) * m_grid.width);
+
+		grid_type strip = m_grid;
+		strip.height = 1;
+		strip.offsetY += static_cast<std::int64_t>(j);
+
+		// The columns wrap around the end of the ring buffer at most once
+		std::size_t i = begin;
+
+		while (i < end)
+		{
+			const std::size_t column = ((m_column + i) % m_grid.width);
+			const std::size_t count = std::min((end - i), (m_grid.width - column));
+
+			strip.width = count;
+			strip.offsetX = (m_grid.offsetX + static_cast<std::int64_t>(i));
+			m_noise.fillOctave2D((row + column), strip, m_octaves, m_persistence);
+
+			i += count;
+		}
 	}
 
 	///////////////////////////////////////
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::octave1D_11(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline BasicNoisePyramid<Float, Kernel>::BasicNoisePyramid(const noise_type& noise, const grid_type& grid, const std::size_t levels, const std::int32_t octaves, const value_type persistence)
 	{
-		return perlin_detail::Clamp_11(octave1D(x, octaves, persistence));
+		std::vector<value_type*> dst;
+
+		for (std::size_t level = 0; level < levels; ++level)
+		{
+			const std::size_t mask = ((std::size_t{ 1 } << level) - 1);
+			Level& l = m_levels.emplace_back();
+			l.width = ((grid.width + mask) >> level);
+			l.height = ((grid.height + mask) >> level);
+			l.octaves = NoisePyramidOctaves(grid, level, octaves);
+			l.data.resize(l.width * l.height);
+			dst.push_back(l.data.data());
+
+			if ((l.width <= 1) && (l.height <= 1))
+			{
+				break;
+			}
+		}
+
+		noise.fillOctave2DPyramid(dst.data(), grid, dst.size(), octaves, persistence);
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::octave2D_11(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline std::size_t BasicNoisePyramid<Float, Kernel>::levels() const noexcept
 	{
-		return perlin_detail::Clamp_11(octave2D(x, y, octaves, persistence));
+		return m_levels.size();
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::octave3D_11(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, NoiseKernel Kernel>
+	inline const typename BasicNoisePyramid<Float, Kernel>::Level& BasicNoisePyramid<Float, Kernel>::level(const std::size_t level) const noexcept
 	{
-		return perlin_detail::Clamp_11(octave3D(x, y, z, octaves, persistence));
+		return m_levels[level];
 	}
 
 	///////////////////////////////////////
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::octave1D_01(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	inline constexpr BasicNoiseBank<Float, K, Kernel>::BasicNoiseBank() noexcept
+		: m_permutations{}
 	{
-		return perlin_detail::RemapClamp_01(octave1D(x, octaves, persistence));
+		for (std::size_t k = 0; k < K; ++k)
+		{
+			set(k, noise_type{});
+		}
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::octave2D_01(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	inline BasicNoiseBank<Float, K, Kernel>::BasicNoiseBank(const std::array<seed_type, K>& seeds)
+		: m_permutations{}
 	{
-		return perlin_detail::RemapClamp_01(octave2D(x, y, octaves, persistence));
+		for (std::size_t k = 0; k < K; ++k)
+		{
+			set(k, noise_type{ seeds[k] });
+		}
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::octave3D_01(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	inline constexpr void BasicNoiseBank<Float, K, Kernel>::set(const std::size_t index, const noise_type& noise) noexcept
 	{
-		return perlin_detail::RemapClamp_01(octave3D(x, y, z, octaves, persistence));
+		m_permutations[index] = perlin_detail::ExpandPermutation(noise.serialize());
 	}
 
-	///////////////////////////////////////
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	inline constexpr typename BasicNoiseBank<Float, K, Kernel>::noise_type BasicNoiseBank<Float, K, Kernel>::noise(const std::size_t index) const noexcept
+	{
+		state_type state{};
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::normalizedOctave1D(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+		for (std::size_t i = 0; i < state.size(); ++i)
+		{
+			state[i] = m_permutations[index][i];
+		}
+
+		noise_type result;
+		result.deserialize(state);
+		return result;
+	}
+
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicNoiseBank<Float, K, Kernel>::result_type BasicNoiseBank<Float, K, Kernel>::noise2D(const value_type x, const value_type y) const noexcept
 	{
-		return (octave1D(x, octaves, persistence) / perlin_detail::MaxAmplitude(octaves, persistence));
+		return octave2D(x, y, 1, value_type(1));
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::normalizedOctave2D(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicNoiseBank<Float, K, Kernel>::result_type BasicNoiseBank<Float, K, Kernel>::noise3D(const value_type x, const value_type y, const value_type z) const noexcept
 	{
-		return (octave2D(x, y, octaves, persistence) / perlin_detail::MaxAmplitude(octaves, persistence));
+		return octave3D(x, y, z, 1, value_type(1));
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::normalizedOctave3D(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicNoiseBank<Float, K, Kernel>::result_type BasicNoiseBank<Float, K, Kernel>::octave2D(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
 	{
-		return (octave3D(x, y, z, octaves, persistence) / perlin_detail::MaxAmplitude(octaves, persistence));
+		perlin_detail::OctaveState<value_type> state{ x, y, static_cast<value_type>(SIVPERLIN_DEFAULT_Z), value_type(1), value_type(0), octaves };
+		result_type result{};
+
+		perlin_detail::AccumulateOctaveBank<2, Kernel, perlin_detail::OctaveLanes<2, Kernel, value_type>>(m_permutations.data(), state, persistence, result);
+
+		return result;
 	}
 
-	///////////////////////////////////////
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	inline SIVPERLIN_CONSTEXPR_CXX20 typename BasicNoiseBank<Float, K, Kernel>::result_type BasicNoiseBank<Float, K, Kernel>::octave3D(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	{
+		perlin_detail::OctaveState<value_type> state{ x, y, z, value_type(1), value_type(0), octaves };
+		result_type result{};
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::normalizedOctave1D_01(const value_type x, const std::int32_t octaves, const value_type persistence) const noexcept
+		perlin_detail::AccumulateOctaveBank<3, Kernel, perlin_detail::OctaveLanes<3, Kernel, value_type>>(m_permutations.data(), state, persistence, result);
+
+		return result;
+	}
+
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicNoiseBank<Float, K, Kernel>::fillOctave2D(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence, const NoiseBankLayout layout) const noexcept
 	{
-		return perlin_detail::Remap_01(normalizedOctave1D(x, octaves, persistence));
+		perlin_detail::FillOctaveBank<2, Kernel, value_type, K>(m_permutations.data(), dst, grid, octaves, persistence, layout, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::normalizedOctave2D_01(const value_type x, const value_type y, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicNoiseBank<Float, K, Kernel>::fillOctave3D(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence, const NoiseBankLayout layout) const noexcept
 	{
-		return perlin_detail::Remap_01(normalizedOctave2D(x, y, octaves, persistence));
+		perlin_detail::FillOctaveBank<3, Kernel, value_type, K>(m_permutations.data(), dst, grid, octaves, persistence, layout, [](const value_type x) { return perlin_detail::ConvertOutput<Output>(x); });
 	}
 
-	template <class Float>
-	inline typename BasicPerlinNoise<Float>::value_type BasicPerlinNoise<Float>::normalizedOctave3D_01(const value_type x, const value_type y, const value_type z, const std::int32_t octaves, const value_type persistence) const noexcept
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicNoiseBank<Float, K, Kernel>::fillOctave2D_01(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence, const NoiseBankLayout layout) const noexcept
 	{
-		return perlin_detail::Remap_01(normalizedOctave3D(x, y, z, octaves, persistence));
+		perlin_detail::FillOctaveBank<2, Kernel, value_type, K>(m_permutations.data(), dst, grid, octaves, persistence, layout, [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::RemapClamp_01(x)); });
+	}
+
+	template <class Float, std::size_t K, NoiseKernel Kernel>
+	template <class Output>
+	inline SIVPERLIN_CONSTEXPR_CXX20 void BasicNoiseBank<Float, K, Kernel>::fillOctave3D_01(Output* dst, const grid_type& grid, const std::int32_t octaves, const value_type persistence, const NoiseBankLayout layout) const noexcept
+	{
+		perlin_detail::FillOctaveBank<3, Kernel, value_type, K>(m_permutations.data(), dst, grid, octaves, persistence, layout, [](const value_type x) { return perlin_detail::ConvertOutput_01<Output>(perlin_detail::RemapClamp_01(x)); });
 	}
 }
 
+# if SIVPERLIN_HAS_RUNTIME_DISPATCH && defined(__clang__)
+#	pragma float_control(pop)
+# endif
+
 # undef SIVPERLIN_NODISCARD_CXX20
+# undef SIVPERLIN_CONSTEXPR_CXX20
+# undef SIVPERLIN_CONSTEXPR_INSTRUMENTED
 # undef SIVPERLIN_CONCEPT_URBG
 # undef SIVPERLIN_CONCEPT_URBG_
@@ -0,0 +1,574 @@
+//----------------------------------------------------------------------------------------
+//
+//	siv::PerlinNoise
+//	Perlin noise library for modern C++
+//
+//	Copyright (C) 2013-2021 Ryo Suzuki <reputeless@gmail.com>
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files(the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions :
+//
+//	The above copyright notice and this permission notice shall be included in
+//	all copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//	THE SOFTWARE.
+//
+//----------------------------------------------------------------------------------------
+
+# pragma once
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <array>
+# include <fstream>
+# include <limits>
+# include <optional>
+# include <string>
+# include <utility>
+# include "PerlinNoise.hpp"
+
+# if defined(_WIN32)
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <Windows.h>
+# else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+# endif
+
+//
+//	Baked noise map file
+//
+//	[NoiseMapHeader][padding to dataOffset][tile (0, 0)][tile (1, 0)] ... [tile (tilesX - 1, tilesY - 1)]
+//
+//	Each tile holds tileSize x tileSize samples of fillOctave2D_01() in row-major order.
+//	Tiles on the right and bottom edges are computed over their full size.
+//	All values are stored in the byte order of the machine that wrote the file.
+//
+
+namespace siv
+{
+	enum class NoiseMapSampleType : std::uint32_t
+	{
+		Float32,
+
+		Float64,
+
+		UInt8,
+
+		UInt16,
+	};
+
+	struct NoiseMapHeader
+	{
+		char magic[8];
+
+		std::uint32_t version;
+
+		// NoiseMapSampleType
+		std::uint32_t sampleType;
+
+		// Size of the map in samples
+		std::uint64_t width, height;
+
+		std::uint32_t tileSize;
+
+		std::int32_t octaves;
+
+		// NoiseKernel
+		std::uint32_t kernel;
+
+		std::uint32_t reserved;
+
+		std::uint64_t tilesX, tilesY;
+
+		// Offset of tile (0, 0) in the file
+		std::uint64_t dataOffset;
+
+		// Sample (i, j) is taken at (x + (offsetX + i) * stepX, y + (offsetY + j) * stepY) like BasicNoiseGrid
+		double x, y;
+
+		double stepX, stepY;
+
+		std::int64_t offsetX, offsetY;
+
+		double persistence;
+
+		// serialize() of the noise
+		std::uint8_t state[256];
+
+		// FNV-1a of state
+		std::uint64_t stateChecksum;
+
+		// FNV-1a of the header up to this member
+		std::uint64_t headerChecksum;
+	};
+
+	static_assert(sizeof(NoiseMapHeader) == 400);
+
+	///////////////////////////////////////
+	//
+	//	Writes a noise map of grid.width x grid.height samples of fillOctave2D_01() on all cores.
+	//	Sample is float, double, std::uint8_t or std::uint16_t. Returns false if the file cannot be written.
+	//
+	template <class Sample, class Float, NoiseKernel Kernel>
+	bool WriteNoiseMap(const std::string& path, const BasicPerlinNoise<Float, Kernel>& noise, const BasicNoiseGrid<Float>& grid,
+		std::uint32_t tileSize, std::int32_t octaves, Float persistence = Float(0.5));
+
+	///////////////////////////////////////
+	//
+	//	Read-only memory-mapped noise map
+	//
+	//	open() validates the header, its checksums and the file size before the map can be used.
+	//	Tiles are returned as pointers into the mapping without copying.
+	//
+	class NoiseMap
+	{
+	public:
+
+		NoiseMap() = default;
+
+		NoiseMap(const NoiseMap&) = delete;
+
+		NoiseMap& operator =(const NoiseMap&) = delete;
+
+		NoiseMap(NoiseMap&& other) noexcept;
+
+		NoiseMap& operator =(NoiseMap&& other) noexcept;
+
+		~NoiseMap();
+
+		[[nodiscard]]
+		bool open(const std::string& path);
+
+		// Also fails if the map was not generated from expectedState
+		[[nodiscard]]
+		bool open(const std::string& path, const std::array<std::uint8_t, 256>& expectedState);
+
+		void close() noexcept;
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		const NoiseMapHeader& header() const noexcept;
+
+		[[nodiscard]]
+		std::array<std::uint8_t, 256> state() const noexcept;
+
+		// Tile (tx, ty), or nullptr if the map is not open, Sample does not match the file or the tile is out of range
+		template <class Sample>
+		[[nodiscard]]
+		const Sample* tile(std::uint64_t tx, std::uint64_t ty) const noexcept;
+
+		// Sample (x, y) of the map, or std::nullopt if the map is not open, Sample does not match the file or (x, y) is outside width x height
+		template <class Sample>
+		[[nodiscard]]
+		std::optional<Sample> at(std::uint64_t x, std::uint64_t y) const noexcept;
+
+	private:
+
+		const std::uint8_t* m_data = nullptr;
+
+		std::size_t m_size = 0;
+
+		std::size_t m_tileBytes = 0;
+
+		bool map(const std::string& path) noexcept;
+	};
+
+	namespace noisemap_detail
+	{
+		inline constexpr char Magic[8] = { 'S', 'I', 'V', 'N', 'M', 'A', 'P', '\0' };
+
+		inline constexpr std::uint32_t Version = 1;
+
+		inline constexpr std::uint64_t Alignment = 4096;
+
+		[[nodiscard]]
+		inline std::uint64_t FNV1a(const void* data, const std::size_t size) noexcept
+		{
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			std::uint64_t h = 14695981039346656037ull;
+
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				h = ((h ^ bytes[i]) * 1099511628211ull);
+			}
+
+			return h;
+		}
+
+		[[nodiscard]]
+		inline std::uint64_t HeaderChecksum(const NoiseMapHeader& header) noexcept
+		{
+			return FNV1a(&header, offsetof(NoiseMapHeader, headerChecksum));
+		}
+
+		template <class Sample>
+		inline constexpr NoiseMapSampleType SampleTypeOf = []
+		{
+			static_assert(std::is_same_v<Sample, float> || std::is_same_v<Sample, double>
+				|| std::is_same_v<Sample, std::uint8_t> || std::is_same_v<Sample, std::uint16_t>,
+				"Sample must be float, double, std::uint8_t or std::uint16_t");
+
+			if constexpr (std::is_same_v<Sample, float>)
+			{
+				return NoiseMapSampleType::Float32;
+			}
+			else if constexpr (std::is_same_v<Sample, double>)
+			{
+				return NoiseMapSampleType::Float64;
+			}
+			else if constexpr (std::is_same_v<Sample, std::uint8_t>)
+			{
+				return NoiseMapSampleType::UInt8;
+			}
+			else
+			{
+				return NoiseMapSampleType::UInt16;
+			}
+		}();
+
+		[[nodiscard]]
+		inline std::size_t SampleSize(const std::uint32_t sampleType) noexcept
+		{
+			switch (static_cast<NoiseMapSampleType>(sampleType))
+			{
+			case NoiseMapSampleType::Float32:
+				return sizeof(float);
+			case NoiseMapSampleType::Float64:
+				return sizeof(double);
+			case NoiseMapSampleType::UInt8:
+				return sizeof(std::uint8_t);
+			case NoiseMapSampleType::UInt16:
+				return sizeof(std::uint16_t);
+			default:
+				return 0;
+			}
+		}
+	}
+
+	///////////////////////////////////////
+
+	template <class Sample, class Float, NoiseKernel Kernel>
+	inline bool WriteNoiseMap(const std::string& path, const BasicPerlinNoise<Float, Kernel>& noise, const BasicNoiseGrid<Float>& grid,
+		const std::uint32_t tileSize, const std::int32_t octaves, const Float persistence)
+	{
+		if ((tileSize == 0) || (grid.width == 0) || (grid.height == 0))
+		{
+			return false;
+		}
+
+		NoiseMapHeader header{};
+		std::memcpy(header.magic, noisemap_detail::Magic, sizeof(header.magic));
+		header.version = noisemap_detail::Version;
+		header.sampleType = static_cast<std::uint32_t>(noisemap_detail::SampleTypeOf<Sample>);
+		header.width = grid.width;
+		header.height = grid.height;
+		header.tileSize = tileSize;
+		header.octaves = octaves;
+		header.kernel = static_cast<std::uint32_t>(Kernel);
+		header.tilesX = ((grid.width + tileSize - 1) / tileSize);
+		header.tilesY = ((grid.height + tileSize - 1) / tileSize);
+		header.dataOffset = noisemap_detail::Alignment;
+		header.x = static_cast<double>(grid.x);
+		header.y = static_cast<double>(grid.y);
+		header.stepX = static_cast<double>(grid.stepX);
+		header.stepY = static_cast<double>(grid.stepY);
+		header.offsetX = grid.offsetX;
+		header.offsetY = grid.offsetY;
+		header.persistence = static_cast<double>(persistence);
+
+		const auto state = noise.serialize();
+		std::memcpy(header.state, state.data(), sizeof(header.state));
+		header.stateChecksum = noisemap_detail::FNV1a(header.state, sizeof(header.state));
+		header.headerChecksum = noisemap_detail::HeaderChecksum(header);
+
+		std::ofstream ofs{ path, std::ios_base::binary | std::ios_base::trunc };
+
+		if (not ofs)
+		{
+			return false;
+		}
+
+		ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		const std::string padding(static_cast<std::size_t>(header.dataOffset - sizeof(header)), '\0');
+		ofs.write(padding.data(), padding.size());
+
+		// One row of tiles is generated in parallel, then written
+		const std::size_t tileSamples = (static_cast<std::size_t>(tileSize) * tileSize);
+		std::vector<Sample> row(static_cast<std::size_t>(header.tilesX) * tileSamples);
+		NoiseThreadPool pool;
+
+		for (std::uint64_t ty = 0; ty < header.tilesY; ++ty)
+		{
+			pool.parallelFor(static_cast<std::size_t>(header.tilesX), [&](const std::size_t tx)
+			{
+				BasicNoiseGrid<Float> tile = grid;
+				tile.width = tileSize;
+				tile.height = tileSize;
+				tile.offsetX = (grid.offsetX + static_cast<std::int64_t>(tx * tileSize));
+				tile.offsetY = (grid.offsetY + static_cast<std::int64_t>(ty * tileSize));
+				noise.fillOctave2D_01((row.data() + tx * tileSamples), tile, octaves, persistence);
+			});
+
+			ofs.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size() * sizeof(Sample)));
+
+			if (not ofs)
+			{
+				return false;
+			}
+		}
+
+		ofs.close();
+
+		return static_cast<bool>(ofs);
+	}
+
+	///////////////////////////////////////
+
+	inline NoiseMap::NoiseMap(NoiseMap&& other) noexcept
+		: m_data{ std::exchange(other.m_data, nullptr) }
+		, m_size{ std::exchange(other.m_size, 0) }
+		, m_tileBytes{ std::exchange(other.m_tileBytes, 0) } {}
+
+	inline NoiseMap& NoiseMap::operator =(NoiseMap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			close();
+			m_data = std::exchange(other.m_data, nullptr);
+			m_size = std::exchange(other.m_size, 0);
+			m_tileBytes = std::exchange(other.m_tileBytes, 0);
+		}
+
+		return *this;
+	}
+
+	inline NoiseMap::~NoiseMap()
+	{
+		close();
+	}
+
+	inline bool NoiseMap::open(const std::string& path)
+	{
+		close();
+
+		if (not map(path))
+		{
+			return false;
+		}
+
+		bool valid = (sizeof(NoiseMapHeader) <= m_size);
+
+		if (valid)
+		{
+			const NoiseMapHeader& h = header();
+			const std::size_t sampleSize = noisemap_detail::SampleSize(h.sampleType);
+
+			valid = ((std::memcmp(h.magic, noisemap_detail::Magic, sizeof(h.magic)) == 0)
+				&& (h.version == noisemap_detail::Version)
+				&& (h.headerChecksum == noisemap_detail::HeaderChecksum(h))
+				&& (h.stateChecksum == noisemap_detail::FNV1a(h.state, sizeof(h.state)))
+				&& (sampleSize != 0) && (h.tileSize != 0)
+				// The checksums do not authenticate the header, so sizes whose arithmetic would wrap around are rejected
+				&& (h.width <= (std::numeric_limits<std::uint64_t>::max() - h.tileSize))
+				&& (h.height <= (std::numeric_limits<std::uint64_t>::max() - h.tileSize))
+				&& (h.tilesX == ((h.width + h.tileSize - 1) / h.tileSize))
+				&& (h.tilesY == ((h.height + h.tileSize - 1) / h.tileSize))
+				&& (h.tileSize <= ((std::numeric_limits<std::size_t>::max() / h.tileSize) / sampleSize))
+				&& (h.dataOffset <= m_size)
+				&& ((h.dataOffset % noisemap_detail::Alignment) == 0));
+
+			if (valid)
+			{
+				m_tileBytes = (static_cast<std::size_t>(h.tileSize) * h.tileSize * sampleSize);
+				const std::uint64_t dataSize = (m_size - h.dataOffset);
+				valid = (((h.tilesY == 0) || (h.tilesX <= ((dataSize / m_tileBytes) / h.tilesY)))
+					&& ((h.tilesX * h.tilesY * m_tileBytes) == dataSize));
+			}
+		}
+
+		if (not valid)
+		{
+			close();
+		}
+
+		return valid;
+	}
+
+	inline bool NoiseMap::open(const std::string& path, const std::array<std::uint8_t, 256>& expectedState)
+	{
+		if (not open(path))
+		{
+			return false;
+		}
+
+		if (std::memcmp(header().state, expectedState.data(), expectedState.size()) != 0)
+		{
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	inline void NoiseMap::close() noexcept
+	{
+		if (m_data)
+		{
+		# if defined(_WIN32)
+			::UnmapViewOfFile(m_data);
+		# else
+			::munmap(const_cast<std::uint8_t*>(m_data), m_size);
+		# endif
+		}
+
+		m_data = nullptr;
+		m_size = 0;
+		m_tileBytes = 0;
+	}
+
+	inline bool NoiseMap::isOpen() const noexcept
+	{
+		return (m_data != nullptr);
+	}
+
+	inline const NoiseMapHeader& NoiseMap::header() const noexcept
+	{
+		return *reinterpret_cast<const NoiseMapHeader*>(m_data);
+	}
+
+	inline std::array<std::uint8_t, 256> NoiseMap::state() const noexcept
+	{
+		std::array<std::uint8_t, 256> result;
+		std::memcpy(result.data(), header().state, result.size());
+		return result;
+	}
+
+	template <class Sample>
+	inline const Sample* NoiseMap::tile(const std::uint64_t tx, const std::uint64_t ty) const noexcept
+	{
+		if (not isOpen())
+		{
+			return nullptr;
+		}
+
+		const NoiseMapHeader& h = header();
+
+		if ((h.sampleType != static_cast<std::uint32_t>(noisemap_detail::SampleTypeOf<Sample>))
+			|| (h.tilesX <= tx) || (h.tilesY <= ty))
+		{
+			return nullptr;
+		}
+
+		return reinterpret_cast<const Sample*>(m_data + h.dataOffset + (ty * h.tilesX + tx) * m_tileBytes);
+	}
+
+	template <class Sample>
+	inline std::optional<Sample> NoiseMap::at(const std::uint64_t x, const std::uint64_t y) const noexcept
+	{
+		if ((not isOpen()) || (header().width <= x) || (header().height <= y))
+		{
+			return std::nullopt;
+		}
+
+		const std::uint64_t tileSize = header().tileSize;
+
+		if (const Sample* t = tile<Sample>((x / tileSize), (y / tileSize)))
+		{
+			return t[(y % tileSize) * tileSize + (x % tileSize)];
+		}
+
+		return std::nullopt;
+	}
+
+	inline bool NoiseMap::map(const std::string& path) noexcept
+	{
+	# if defined(_WIN32)
+
+		const HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER size;
+
+		if ((not ::GetFileSizeEx(file, &size)) || (size.QuadPart == 0))
+		{
+			::CloseHandle(file);
+			return false;
+		}
+
+		const HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		::CloseHandle(file);
+
+		if (mapping == nullptr)
+		{
+			return false;
+		}
+
+		const void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		::CloseHandle(mapping);
+
+		if (view == nullptr)
+		{
+			return false;
+		}
+
+		m_data = static_cast<const std::uint8_t*>(view);
+		m_size = static_cast<std::size_t>(size.QuadPart);
+
+	# else
+
+		const int fd = ::open(path.c_str(), O_RDONLY);
+
+		if (fd < 0)
+		{
+			return false;
+		}
+
+		struct stat status;
+
+		if ((::fstat(fd, &status) != 0) || (status.st_size == 0))
+		{
+			::close(fd);
+			return false;
+		}
+
+		void* view = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_SHARED, fd, 0);
+		::close(fd);
+
+		if (view == MAP_FAILED)
+		{
+			return false;
+		}
+
+		m_data = static_cast<const std::uint8_t*>(view);
+		m_size = static_cast<std::size_t>(status.st_size);
+
+	# endif
+
+		return true;
+	}
+}
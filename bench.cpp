@@ -0,0 +1,365 @@
+# include <chrono>
+# include <cstring>
+# include <iostream>
+# include <random>
+# include <string>
+# include <vector>
+# define SIVPERLIN_RUNTIME_DISPATCH 1
+# include "PerlinNoise.hpp"
+
+//
+//	bench [csv|json] [samples]
+//
+//	Reports ns/sample and samples/second for every public noise entry point of each NoiseKernel.
+//	Each measurement is the best of several repetitions after a warm-up run.
+//	The fills use the runtime CPU dispatch. SIVPERLIN_SIMD_LEVEL=baseline measures the code for the compiler flags.
+//
+
+struct Result
+{
+	std::string function;
+	std::string type;
+	std::string kernel;
+	std::int32_t octaves = 0;
+	std::string pattern;
+	std::size_t samples = 0;
+	double nsPerSample = 0.0;
+};
+
+class Reporter
+{
+public:
+
+	void add(std::string function, std::string type, std::string kernel, std::int32_t octaves, std::string pattern, std::size_t samples, double nsPerSample)
+	{
+		m_results.push_back({ std::move(function), std::move(type), std::move(kernel), octaves, std::move(pattern), samples, nsPerSample });
+		std::cerr << '.';
+	}
+
+	void writeCSV(std::ostream& os) const
+	{
+		os << "function,type,kernel,octaves,pattern,samples,ns_per_sample,samples_per_second\n";
+
+		for (const auto& r : m_results)
+		{
+			os << r.function << ',' << r.type << ',' << r.kernel << ',' << r.octaves << ',' << r.pattern << ',' << r.samples << ','
+				<< r.nsPerSample << ',' << (1e9 / r.nsPerSample) << '\n';
+		}
+	}
+
+	void writeJSON(std::ostream& os) const
+	{
+		os << "{\n";
+		os << "  \"version\": " << SIVPERLIN_VERSION << ",\n";
+		os << "  \"simd_bytes\": " << SIVPERLIN_SIMD_BYTES << ",\n";
+		os << "  \"simd_level\": " << static_cast<int>(siv::GetNoiseSimdLevel()) << ",\n";
+		os << "  \"results\": [\n";
+
+		for (std::size_t i = 0; i < m_results.size(); ++i)
+		{
+			const Result& r = m_results[i];
+			os << "    { \"function\": \"" << r.function << "\", \"type\": \"" << r.type << "\", \"kernel\": \"" << r.kernel << "\", \"octaves\": " << r.octaves
+				<< ", \"pattern\": \"" << r.pattern << "\", \"samples\": " << r.samples
+				<< ", \"ns_per_sample\": " << r.nsPerSample << ", \"samples_per_second\": " << (1e9 / r.nsPerSample) << " }"
+				<< ((i + 1 < m_results.size()) ? ",\n" : "\n");
+		}
+
+		os << "  ]\n";
+		os << "}\n";
+	}
+
+private:
+
+	std::vector<Result> m_results;
+};
+
+// Keeps the results alive so that the measured code is not optimized away
+volatile double g_sink = 0.0;
+
+// Returns the best ns/call of func(i) for i in [0, count)
+template <class Func>
+double Measure(const std::size_t count, Func&& func)
+{
+	constexpr std::int32_t Repetitions = 5;
+	double best = 1e300;
+
+	for (std::int32_t r = 0; r <= Repetitions; ++r)
+	{
+		double sum = 0.0;
+		const auto start = std::chrono::steady_clock::now();
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			sum += static_cast<double>(func(i));
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+		g_sink = g_sink + sum;
+
+		// The first run is a warm-up
+		if (r != 0)
+		{
+			best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count());
+		}
+	}
+
+	return (best / static_cast<double>(count));
+}
+
+template <class Float>
+struct Coordinates
+{
+	std::vector<Float> x, y, z;
+};
+
+// grid: consecutive samples are neighbors on a 256 x 256 x n lattice with a step of 1/16
+// random: uniformly distributed in [-256, 256)
+template <class Float>
+Coordinates<Float> MakeCoordinates(const std::string& pattern, const std::size_t samples)
+{
+	Coordinates<Float> c;
+	c.x.resize(samples);
+	c.y.resize(samples);
+	c.z.resize(samples);
+
+	std::mt19937 rng{ 2024u };
+	std::uniform_real_distribution<double> dist{ -256.0, 256.0 };
+
+	for (std::size_t i = 0; i < samples; ++i)
+	{
+		if (pattern == "grid")
+		{
+			c.x[i] = static_cast<Float>((i % 256) / 16.0);
+			c.y[i] = static_cast<Float>(((i / 256) % 256) / 16.0);
+			c.z[i] = static_cast<Float>((i / 65536) / 16.0);
+		}
+		else
+		{
+			c.x[i] = static_cast<Float>(dist(rng));
+			c.y[i] = static_cast<Float>(dist(rng));
+			c.z[i] = static_cast<Float>(dist(rng));
+		}
+	}
+
+	return c;
+}
+
+template <siv::NoiseKernel Kernel>
+const char* KernelName()
+{
+	switch (Kernel)
+	{
+	case siv::NoiseKernel::Compatible:
+		return "compatible";
+	case siv::NoiseKernel::Dedicated:
+		return "dedicated";
+	default:
+		return "simplex";
+	}
+}
+
+template <class Float, siv::NoiseKernel Kernel>
+void BenchScalar(Reporter& reporter, const std::string& type, const std::size_t samples)
+{
+	const siv::BasicPerlinNoise<Float, Kernel> perlin{ 12345u };
+
+	for (const std::string pattern : { "grid", "random" })
+	{
+		const Coordinates<Float> c = MakeCoordinates<Float>(pattern, samples);
+		const Float* x = c.x.data();
+		const Float* y = c.y.data();
+		const Float* z = c.z.data();
+
+		const auto add = [&](const char* function, const std::int32_t octaves, auto&& func)
+		{
+			reporter.add(function, type, KernelName<Kernel>(), octaves, pattern, samples, Measure(samples, func));
+		};
+
+		add("noise1D", 1, [&](std::size_t i) { return perlin.noise1D(x[i]); });
+		add("noise2D", 1, [&](std::size_t i) { return perlin.noise2D(x[i], y[i]); });
+		add("noise3D", 1, [&](std::size_t i) { return perlin.noise3D(x[i], y[i], z[i]); });
+		add("noise1D_01", 1, [&](std::size_t i) { return perlin.noise1D_01(x[i]); });
+		add("noise2D_01", 1, [&](std::size_t i) { return perlin.noise2D_01(x[i], y[i]); });
+		add("noise3D_01", 1, [&](std::size_t i) { return perlin.noise3D_01(x[i], y[i], z[i]); });
+		add("noise2DDerivative", 1, [&](std::size_t i) { return perlin.noise2DDerivative(x[i], y[i]).value; });
+		add("noise3DDerivative", 1, [&](std::size_t i) { return perlin.noise3DDerivative(x[i], y[i], z[i]).value; });
+
+		for (const std::int32_t o : { 1, 4, 8 })
+		{
+			add("octave1D", o, [&](std::size_t i) { return perlin.octave1D(x[i], o); });
+			add("octave2D", o, [&](std::size_t i) { return perlin.octave2D(x[i], y[i], o); });
+			add("octave3D", o, [&](std::size_t i) { return perlin.octave3D(x[i], y[i], z[i], o); });
+			add("octave1D_11", o, [&](std::size_t i) { return perlin.octave1D_11(x[i], o); });
+			add("octave2D_11", o, [&](std::size_t i) { return perlin.octave2D_11(x[i], y[i], o); });
+			add("octave3D_11", o, [&](std::size_t i) { return perlin.octave3D_11(x[i], y[i], z[i], o); });
+			add("octave1D_01", o, [&](std::size_t i) { return perlin.octave1D_01(x[i], o); });
+			add("octave2D_01", o, [&](std::size_t i) { return perlin.octave2D_01(x[i], y[i], o); });
+			add("octave3D_01", o, [&](std::size_t i) { return perlin.octave3D_01(x[i], y[i], z[i], o); });
+			add("normalizedOctave1D", o, [&](std::size_t i) { return perlin.normalizedOctave1D(x[i], o); });
+			add("normalizedOctave2D", o, [&](std::size_t i) { return perlin.normalizedOctave2D(x[i], y[i], o); });
+			add("normalizedOctave3D", o, [&](std::size_t i) { return perlin.normalizedOctave3D(x[i], y[i], z[i], o); });
+			add("normalizedOctave1D_01", o, [&](std::size_t i) { return perlin.normalizedOctave1D_01(x[i], o); });
+			add("normalizedOctave2D_01", o, [&](std::size_t i) { return perlin.normalizedOctave2D_01(x[i], y[i], o); });
+			add("normalizedOctave3D_01", o, [&](std::size_t i) { return perlin.normalizedOctave3D_01(x[i], y[i], z[i], o); });
+			add("octave2DDerivative", o, [&](std::size_t i) { return perlin.octave2DDerivative(x[i], y[i], o).value; });
+			add("octave3DDerivative", o, [&](std::size_t i) { return perlin.octave3DDerivative(x[i], y[i], z[i], o).value; });
+		}
+	}
+}
+
+template <class Float, siv::NoiseKernel Kernel>
+void BenchBatch(Reporter& reporter, const std::string& type, const std::size_t samples)
+{
+	using Noise = siv::BasicPerlinNoise<Float, Kernel>;
+	const Noise perlin{ 12345u };
+
+	const std::size_t side2D = std::max<std::size_t>(16, static_cast<std::size_t>(std::sqrt(static_cast<double>(samples))));
+	const std::size_t side3D = std::max<std::size_t>(4, static_cast<std::size_t>(std::cbrt(static_cast<double>(samples))));
+	const typename Noise::grid_type grid2D{ Float(0.5), Float(0.5), Float(0.5), Float(1.0 / 16), Float(1.0 / 16), Float(1.0 / 16), side2D, side2D };
+	const typename Noise::grid_type grid3D{ Float(0.5), Float(0.5), Float(0.5), Float(1.0 / 16), Float(1.0 / 16), Float(1.0 / 16), side3D, side3D, side3D };
+	const std::size_t count2D = (side2D * side2D);
+	const std::size_t count3D = (side3D * side3D * side3D);
+
+	std::vector<Float> dst(std::max(count2D, count3D));
+	std::vector<typename Noise::derivative2D_type> dst2D(count2D);
+	std::vector<typename Noise::derivative3D_type> dst3D(count3D);
+
+	// Each fill call is measured as a whole and reported per sample
+	const auto add = [&](const char* function, const std::int32_t octaves, const std::size_t count, auto&& fill)
+	{
+		const double ns = Measure(1, [&](std::size_t) { fill(); return dst[count / 2]; });
+		reporter.add(function, type, KernelName<Kernel>(), octaves, "batch", count, (ns / static_cast<double>(count)));
+	};
+
+	add("fillNoise2D", 1, count2D, [&]() { perlin.fillNoise2D(dst.data(), grid2D); });
+	add("fillNoise3D", 1, count3D, [&]() { perlin.fillNoise3D(dst.data(), grid3D); });
+	add("fillNoise2D_01", 1, count2D, [&]() { perlin.fillNoise2D_01(dst.data(), grid2D); });
+	add("fillNoise3D_01", 1, count3D, [&]() { perlin.fillNoise3D_01(dst.data(), grid3D); });
+	add("fillNoise2DDerivative", 1, count2D, [&]() { perlin.fillNoise2DDerivative(dst2D.data(), grid2D); });
+	add("fillNoise3DDerivative", 1, count3D, [&]() { perlin.fillNoise3DDerivative(dst3D.data(), grid3D); });
+
+	for (const std::int32_t o : { 1, 4, 8 })
+	{
+		add("fillOctave2D", o, count2D, [&]() { perlin.fillOctave2D(dst.data(), grid2D, o); });
+		add("fillOctave3D", o, count3D, [&]() { perlin.fillOctave3D(dst.data(), grid3D, o); });
+		add("fillOctave2D_11", o, count2D, [&]() { perlin.fillOctave2D_11(dst.data(), grid2D, o); });
+		add("fillOctave3D_11", o, count3D, [&]() { perlin.fillOctave3D_11(dst.data(), grid3D, o); });
+		add("fillOctave2D_01", o, count2D, [&]() { perlin.fillOctave2D_01(dst.data(), grid2D, o); });
+		add("fillOctave3D_01", o, count3D, [&]() { perlin.fillOctave3D_01(dst.data(), grid3D, o); });
+		add("fillNormalizedOctave2D", o, count2D, [&]() { perlin.fillNormalizedOctave2D(dst.data(), grid2D, o); });
+		add("fillNormalizedOctave3D", o, count3D, [&]() { perlin.fillNormalizedOctave3D(dst.data(), grid3D, o); });
+		add("fillNormalizedOctave2D_01", o, count2D, [&]() { perlin.fillNormalizedOctave2D_01(dst.data(), grid2D, o); });
+		add("fillNormalizedOctave3D_01", o, count3D, [&]() { perlin.fillNormalizedOctave3D_01(dst.data(), grid3D, o); });
+		add("fillOctave2DDerivative", o, count2D, [&]() { perlin.fillOctave2DDerivative(dst2D.data(), grid2D, o); });
+		add("fillOctave3DDerivative", o, count3D, [&]() { perlin.fillOctave3DDerivative(dst3D.data(), grid3D, o); });
+	}
+}
+
+// octave3D() and fillOctave2D() of a BasicFixedPoint type, to compare with the float and double rows of the same functions
+template <class Fixed>
+void BenchFixedPoint(Reporter& reporter, const std::string& type, const std::size_t samples)
+{
+	using Noise = siv::BasicPerlinNoise<Fixed>;
+	const Noise perlin{ 12345u };
+
+	for (const std::string pattern : { "grid", "random" })
+	{
+		const Coordinates<Fixed> c = MakeCoordinates<Fixed>(pattern, samples);
+
+		for (const std::int32_t o : { 1, 4, 8 })
+		{
+			reporter.add("octave3D", type, KernelName<siv::NoiseKernel::Compatible>(), o, pattern, samples, Measure(samples, [&](std::size_t i)
+			{
+				return perlin.octave3D(c.x[i], c.y[i], c.z[i], o);
+			}));
+		}
+	}
+
+	const std::size_t side = std::max<std::size_t>(16, static_cast<std::size_t>(std::sqrt(static_cast<double>(samples))));
+	const typename Noise::grid_type grid{ Fixed(0.5), Fixed(0.5), Fixed(0.5), Fixed(1.0 / 16), Fixed(1.0 / 16), Fixed(1.0 / 16), side, side };
+	std::vector<Fixed> dst(side * side);
+
+	for (const std::int32_t o : { 1, 4, 8 })
+	{
+		const double ns = Measure(1, [&](std::size_t) { perlin.fillOctave2D(dst.data(), grid, o); return dst[dst.size() / 2]; });
+		reporter.add("fillOctave2D", type, KernelName<siv::NoiseKernel::Compatible>(), o, "batch", dst.size(), (ns / static_cast<double>(dst.size())));
+	}
+}
+
+template <class Float>
+void BenchState(Reporter& reporter, const std::string& type, const std::size_t samples)
+{
+	using Noise = siv::BasicPerlinNoise<Float>;
+	Noise perlin;
+	const typename Noise::state_type state = Noise{ 12345u }.serialize();
+	const std::size_t count = std::max<std::size_t>(16, (samples / 256));
+
+	reporter.add("reseed", type, KernelName<siv::NoiseKernel::Compatible>(), 0, "seed", count, Measure(count, [&](std::size_t i)
+	{
+		perlin.reseed(static_cast<typename Noise::seed_type>(i));
+		return perlin.serialize()[0];
+	}));
+
+	reporter.add("reseedFast", type, KernelName<siv::NoiseKernel::Compatible>(), 0, "seed", count, Measure(count, [&](std::size_t i)
+	{
+		perlin.reseedFast(i);
+		return perlin.serialize()[0];
+	}));
+
+	std::mt19937 urbg{ 12345u };
+
+	reporter.add("reseed", type, KernelName<siv::NoiseKernel::Compatible>(), 0, "urbg", count, Measure(count, [&](std::size_t)
+	{
+		perlin.reseed(urbg);
+		return perlin.serialize()[0];
+	}));
+
+	reporter.add("serialize", type, KernelName<siv::NoiseKernel::Compatible>(), 0, "state", count, Measure(count, [&](std::size_t)
+	{
+		return perlin.serialize()[0];
+	}));
+
+	reporter.add("deserialize", type, KernelName<siv::NoiseKernel::Compatible>(), 0, "state", count, Measure(count, [&](std::size_t i)
+	{
+		perlin.deserialize(state);
+		return perlin.noise1D(static_cast<Float>(i));
+	}));
+}
+
+int main(int argc, char* argv[])
+{
+	const bool json = ((1 < argc) && (std::strcmp(argv[1], "json") == 0));
+	const std::size_t samples = ((2 < argc) ? static_cast<std::size_t>(std::stoull(argv[2])) : (1 << 16));
+
+	Reporter reporter;
+
+	BenchScalar<float, siv::NoiseKernel::Compatible>(reporter, "float", samples);
+	BenchScalar<float, siv::NoiseKernel::Dedicated>(reporter, "float", samples);
+	BenchScalar<float, siv::NoiseKernel::Simplex>(reporter, "float", samples);
+	BenchScalar<double, siv::NoiseKernel::Compatible>(reporter, "double", samples);
+	BenchScalar<double, siv::NoiseKernel::Dedicated>(reporter, "double", samples);
+	BenchScalar<double, siv::NoiseKernel::Simplex>(reporter, "double", samples);
+	BenchBatch<float, siv::NoiseKernel::Compatible>(reporter, "float", samples);
+	BenchBatch<float, siv::NoiseKernel::Dedicated>(reporter, "float", samples);
+	BenchBatch<float, siv::NoiseKernel::Simplex>(reporter, "float", samples);
+	BenchBatch<double, siv::NoiseKernel::Compatible>(reporter, "double", samples);
+	BenchBatch<double, siv::NoiseKernel::Dedicated>(reporter, "double", samples);
+	BenchBatch<double, siv::NoiseKernel::Simplex>(reporter, "double", samples);
+	BenchFixedPoint<siv::FixedPoint32>(reporter, "FixedPoint32", samples);
+# if defined(__SIZEOF_INT128__)
+	BenchFixedPoint<siv::FixedPoint64>(reporter, "FixedPoint64", samples);
+# endif
+	BenchState<float>(reporter, "float", samples);
+	BenchState<double>(reporter, "double", samples);
+
+	std::cerr << '\n';
+
+	if (json)
+	{
+		reporter.writeJSON(std::cout);
+	}
+	else
+	{
+		reporter.writeCSV(std::cout);
+	}
+}
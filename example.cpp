@@ -2,6 +2,7 @@
 # include <iostream>
 # include <fstream>
 # include <sstream>
+# define SIVPERLIN_RUNTIME_DISPATCH 1
 # include "PerlinNoise.hpp"
 
 # pragma pack (push, 1)
@@ -29,13 +30,13 @@ static_assert(sizeof(BMPHeader) == 54);
 
 struct RGB
 {
-	double r = 0.0;
-	double g = 0.0;
-	double b = 0.0;
+	std::uint8_t r = 0;
+	std::uint8_t g = 0;
+	std::uint8_t b = 0;
 	constexpr RGB() = default;
-	explicit constexpr RGB(double _rgb) noexcept
+	explicit constexpr RGB(std::uint8_t _rgb) noexcept
 		: r{ _rgb }, g{ _rgb }, b{ _rgb } {}
-	constexpr RGB(double _r, double _g, double _b) noexcept
+	constexpr RGB(std::uint8_t _r, std::uint8_t _g, std::uint8_t _b) noexcept
 		: r{ _r }, g{ _g }, b{ _b } {}
 };
 
@@ -90,9 +91,9 @@ public:
 				for (std::int32_t x = 0; x < m_width; ++x)
 				{
 					const RGB& col = m_data[static_cast<std::size_t>(y) * m_width + x];
-					line[pos++] = ToUint8(col.b);
-					line[pos++] = ToUint8(col.g);
-					line[pos++] = ToUint8(col.r);
+					line[pos++] = col.b;
+					line[pos++] = col.g;
+					line[pos++] = col.r;
 				}
 
 				ofs.write(reinterpret_cast<const char*>(line.data()), line.size());
@@ -116,11 +117,6 @@ private:
 	{
 		return (0 <= y) && (y < m_height) && (0 <= x) && (x < m_width);
 	}
-
-	static constexpr std::uint8_t ToUint8(double x) noexcept
-	{
-		return (x <= 0.0) ? 0 : (1.0 <= x) ? 255 : static_cast<std::uint8_t>(x * 255.0 + 0.5);
-	}
 };
 
 void Test()
@@ -145,15 +141,145 @@ void Test()
 	assert(perlinA.octave3D(0.1, 0.2, 0.3, 4)
 		== perlinB.octave3D(0.1, 0.2, 0.3, 4));
 
+	std::mt19937 urbgA{ 67890u }, urbgB{ 67890u };
+	perlinA.reseed(urbgA);
+	perlinB.reseed(urbgB);
+
+	assert(perlinA.octave3D(0.1, 0.2, 0.3, 4)
+		== perlinB.octave3D(0.1, 0.2, 0.3, 4));
+
+	std::vector<double> grid(20 * 20);
+	perlinA.fillOctave2D_01(grid.data(), { 0.0, 0.0, 0.0, 0.1, 0.1, 1.0, 20, 20 }, 6);
+
 	for (std::int32_t y = 0; y < 20; ++y)
 	{
 		for (std::int32_t x = 0; x < 20; ++x)
 		{
 			const double noise = perlinA.octave2D_01(x * 0.1, y * 0.1, 6);
+			assert(std::abs(grid[y * 20 + x] - noise) <= 1e-12);
 			std::cout << static_cast<int>(std::floor(noise * 10) - 0.5);
 		}
 		std::cout << '\n';
 	}
+
+	// Lattice coordinates beyond the range of std::int32_t
+	for (const double x : { 3e9, -3e9, 1e7 + 0.3, 1e30 })
+	{
+		double row[8];
+		perlinA.fillNoise2D(row, { x, 0.5, 0.0, 0.25, 1.0, 1.0, 8, 1 });
+
+		for (std::int32_t i = 0; i < 8; ++i)
+		{
+			const double noise = perlinA.noise2D(x + i * 0.25, 0.5);
+			assert(std::abs(noise) <= 1.0);
+			assert(std::abs(row[i] - noise) <= 1e-12);
+		}
+
+		perlinA.fillOctave2D(row, { x, 0.6, 0.0, 0.25, 1.0, 1.0, 8, 1 }, 10);
+
+		for (std::int32_t i = 0; i < 8; ++i)
+		{
+			const double noise = perlinA.octave2D(x + i * 0.25, 0.6, 10);
+			assert(std::abs(noise) <= 2.0);
+			assert(std::abs(row[i] - noise) <= 1e-12);
+		}
+	}
+
+	// High octaves also reach coordinates beyond the range of std::int32_t
+	for (const std::int32_t octaves : { 10, 32, 40 })
+	{
+		assert(std::abs(perlinA.octave1D(1e7 + 0.3, octaves)) <= 2.0);
+		assert(std::abs(perlinA.octave2D(1e7 + 0.3, 0.6, octaves)) <= 2.0);
+		assert(std::abs(perlinA.octave3D(1.3, 2.7, 3.1, octaves)) <= 2.0);
+	}
+
+	// Periodic noise at such coordinates
+	assert(perlinA.periodicNoise1D(0.25, 7) == perlinA.periodicNoise1D(7e9 + 0.25, 7));
+	assert(std::abs(perlinA.periodicOctave2D(1e7 + 0.3, 0.6, 7, 5, 40)) <= 2.0);
+
+	// The separable octave fill at such coordinates
+	{
+		double row[16];
+		perlinA.fillOctave3D(row, { 3e9, 3e9, 3e9, (1.0 / 64), (1.0 / 64), (1.0 / 64), 16, 1, 1 }, 4);
+
+		for (std::int32_t i = 0; i < 16; ++i)
+		{
+			const double noise = perlinA.octave3D(3e9 + i / 64.0, 3e9, 3e9, 4);
+			assert(std::abs(noise) <= 2.0);
+			assert(std::abs(row[i] - noise) <= 1e-12);
+		}
+	}
+
+	// The cell-by-cell octave fill at such coordinates
+	{
+		double row[16];
+		perlinA.fillOctave2D(row, { 3e9, 3e9, 0.0, (1.0 / 64), 1.0, 1.0, 16, 1 }, 4);
+
+		for (std::int32_t i = 0; i < 16; ++i)
+		{
+			const double noise = perlinA.octave2D(3e9 + i / 64.0, 3e9, 4);
+			assert(std::abs(noise) <= 2.0);
+			assert(std::abs(row[i] - noise) <= 1e-12);
+		}
+	}
+
+	// NoiseKernel::Simplex at such coordinates
+	{
+		const siv::BasicPerlinNoise<double, siv::NoiseKernel::Simplex> simplex{ 12345u };
+		double row[16];
+		simplex.fillNoise2D(row, { 3e9, 0.5, 0.0, 0.25, 1.0, 1.0, 16, 1 });
+
+		for (std::int32_t i = 0; i < 16; ++i)
+		{
+			const double noise = simplex.noise2D(3e9 + i * 0.25, 0.5);
+			assert(std::abs(noise) <= 1.0);
+			assert(std::abs(row[i] - noise) <= 1e-12);
+		}
+
+		assert(simplex.noise1D(3e9 + 0.25) == simplex.noise1D(0.25));
+		assert(std::abs(simplex.noise3D(3e9 + 0.25, 3e9 + 0.5, 3e9 + 0.75) - simplex.noise3D(0.25, 0.5, 0.75)) <= 1e-6);
+		assert(std::abs(simplex.octave3D(1.3, 2.7, 3.1, 40)) <= 2.0);
+	}
+
+	// Every SIMD level of the runtime dispatch gives the same fills
+	{
+		const siv::PerlinNoise::grid_type grid3D{ 0.3, 0.7, 0.1, 0.013, 0.017, 0.019, 40, 30, 4 };
+		std::vector<double> supported(40 * 30 * 4), baseline(supported.size());
+
+		for (const std::int32_t octaves : { 1, 4, 8 })
+		{
+			siv::SetNoiseSimdLevel(siv::GetSupportedNoiseSimdLevel());
+			perlinA.fillOctave3D(supported.data(), grid3D, octaves);
+			siv::SetNoiseSimdLevel(siv::NoiseSimdLevel::Baseline);
+			perlinA.fillOctave3D(baseline.data(), grid3D, octaves);
+			assert(supported == baseline);
+
+			siv::SetNoiseSimdLevel(siv::GetSupportedNoiseSimdLevel());
+			perlinA.fillOctave2D(supported.data(), grid3D, octaves);
+			siv::SetNoiseSimdLevel(siv::NoiseSimdLevel::Baseline);
+			perlinA.fillOctave2D(baseline.data(), grid3D, octaves);
+			assert(supported == baseline);
+		}
+
+		siv::SetNoiseSimdLevel(siv::GetSupportedNoiseSimdLevel());
+	}
+
+	// A default-constructed request does not refer to a chunk
+	{
+		siv::NoiseChunkGenerator::Request request;
+		assert(not request.valid());
+		assert(request.status() == siv::NoiseChunkGenerator::Status::Cancelled);
+		assert(not request.cancel());
+	}
+
+# if __cpp_lib_is_constant_evaluated
+
+	constexpr siv::PerlinNoise perlinC;
+	constexpr double noiseC = perlinC.octave3D(0.1, 0.2, 0.3, 4);
+	static_assert((-1.0 <= noiseC) && (noiseC <= 1.0));
+	assert(std::abs(noiseC - perlinC.octave3D(0.1, 0.2, 0.3, 4)) <= 1e-12);
+
+# endif
 }
 
 int main()
@@ -188,11 +314,16 @@ int main()
 		const double fx = (frequency / image.width());
 		const double fy = (frequency / image.height());
 
+		const siv::PerlinNoise::grid_type grid{ 0.0, 0.0, 0.0, fx, fy, 1.0,
+			static_cast<std::size_t>(image.width()), static_cast<std::size_t>(image.height()) };
+		std::vector<std::uint8_t> noise(grid.width * grid.height);
+		perlin.fillOctave2D_01(noise.data(), grid, octaves);
+
 		for (std::int32_t y = 0; y < image.height(); ++y)
 		{
 			for (std::int32_t x = 0; x < image.width(); ++x)
 			{
-				const RGB color(perlin.octave2D_01((x * fx), (y * fy), octaves));
+				const RGB color(noise[static_cast<std::size_t>(y) * image.width() + x]);
 				image.set(x, y, color);
 			}
 		}
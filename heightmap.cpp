@@ -0,0 +1,315 @@
+# include <cstring>
+# include <fstream>
+# include <future>
+# include <iostream>
+# include <string>
+# include <vector>
+# include "PerlinNoiseMap.hpp"
+
+//
+//	heightmap output.(bmp|pgm|raw|nmap) width height [frequency] [octaves] [seed] [bits] [bandRows]
+//
+//	Writes fillOctave2D_01() of any size without holding the whole image in memory.
+//	The image is generated in bands of bandRows rows on all cores, and each band is written
+//	on a separate thread while the next one is generated (double buffering).
+//	Memory use is about 2 * width * bandRows * (bits / 8) bytes.
+//
+//	bmp : 8-bit grayscale, stored top-down
+//	pgm : 8 or 16-bit binary PGM (P5)
+//	raw : 8 or 16-bit samples without a header, little-endian
+//	nmap : 8 or 16-bit tiled noise map of bandRows x bandRows samples (PerlinNoiseMap.hpp)
+//
+
+# pragma pack (push, 1)
+struct BMPHeader
+{
+	std::uint16_t bfType;
+	std::uint32_t bfSize;
+	std::uint16_t bfReserved1;
+	std::uint16_t bfReserved2;
+	std::uint32_t bfOffBits;
+	std::uint32_t biSize;
+	std::int32_t  biWidth;
+	std::int32_t  biHeight;
+	std::uint16_t biPlanes;
+	std::uint16_t biBitCount;
+	std::uint32_t biCompression;
+	std::uint32_t biSizeImage;
+	std::int32_t  biXPelsPerMeter;
+	std::int32_t  biYPelsPerMeter;
+	std::uint32_t biClrUsed;
+	std::uint32_t biClrImportant;
+};
+static_assert(sizeof(BMPHeader) == 54);
+# pragma pack (pop)
+
+enum class Format
+{
+	BMP,
+	PGM,
+	Raw,
+
+	NoiseMap,
+};
+
+struct Options
+{
+	std::string path;
+	Format format = Format::PGM;
+	std::size_t width = 0;
+	std::size_t height = 0;
+	double frequency = 8.0;
+	std::int32_t octaves = 8;
+	std::uint32_t seed = 12345;
+	std::int32_t bits = 8;
+	std::size_t bandRows = 256;
+};
+
+class BandWriter
+{
+public:
+
+	BandWriter(const Options& options, std::ofstream& ofs)
+		: m_options{ options }
+		, m_ofs{ ofs }
+		, m_rowBytes{ options.width * static_cast<std::size_t>(options.bits / 8) }
+		, m_padding{ (options.format == Format::BMP) ? ((4 - (m_rowBytes % 4)) % 4) : 0 } {}
+
+	bool writeHeader()
+	{
+		if (m_options.format == Format::BMP)
+		{
+			const std::uint64_t imageSize = (static_cast<std::uint64_t>(m_rowBytes + m_padding) * m_options.height);
+			const std::uint32_t offset = static_cast<std::uint32_t>(sizeof(BMPHeader) + 256 * 4);
+
+			if ((0xFFFF'FFFFull - offset) < imageSize)
+			{
+				std::cerr << "BMP files are limited to 4 GiB\n";
+				return false;
+			}
+
+			// A negative height stores the rows top-down, in the order they are generated
+			const BMPHeader header =
+			{
+				0x4d42,
+				static_cast<std::uint32_t>(imageSize + offset),
+				0, 0, offset, 40,
+				static_cast<std::int32_t>(m_options.width), -static_cast<std::int32_t>(m_options.height), 1, 8,
+				0, static_cast<std::uint32_t>(imageSize), 0, 0, 256, 0
+			};
+
+			m_ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+			for (std::uint32_t i = 0; i < 256; ++i)
+			{
+				const std::uint8_t entry[4] = { static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i), 0 };
+				m_ofs.write(reinterpret_cast<const char*>(entry), sizeof(entry));
+			}
+		}
+		else if (m_options.format == Format::PGM)
+		{
+			m_ofs << "P5\n" << m_options.width << ' ' << m_options.height << '\n' << ((m_options.bits == 8) ? 255 : 65535) << '\n';
+		}
+
+		return static_cast<bool>(m_ofs);
+	}
+
+	// Converts 16-bit samples to the byte order of the file. Called on the generating thread.
+	void prepare(std::uint16_t* samples, const std::size_t count) const noexcept
+	{
+		const bool bigEndian = (m_options.format == Format::PGM);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const std::uint16_t value = samples[i];
+			const std::uint8_t bytes[2] =
+			{
+				static_cast<std::uint8_t>(bigEndian ? (value >> 8) : (value & 0xFF)),
+				static_cast<std::uint8_t>(bigEndian ? (value & 0xFF) : (value >> 8)),
+			};
+			std::memcpy(&samples[i], bytes, 2);
+		}
+	}
+
+	bool writeRows(const void* data, const std::size_t rows)
+	{
+		const char* bytes = static_cast<const char*>(data);
+
+		if (m_padding == 0)
+		{
+			m_ofs.write(bytes, (m_rowBytes * rows));
+		}
+		else
+		{
+			const char zeros[4] = {};
+
+			for (std::size_t j = 0; j < rows; ++j)
+			{
+				m_ofs.write((bytes + j * m_rowBytes), m_rowBytes);
+				m_ofs.write(zeros, m_padding);
+			}
+		}
+
+		return static_cast<bool>(m_ofs);
+	}
+
+private:
+
+	const Options& m_options;
+
+	std::ofstream& m_ofs;
+
+	std::size_t m_rowBytes;
+
+	std::size_t m_padding;
+};
+
+template <class Sample>
+bool Export(const Options& options)
+{
+	std::ofstream ofs{ options.path, std::ios_base::binary };
+
+	if (not ofs)
+	{
+		std::cerr << "Cannot open " << options.path << '\n';
+		return false;
+	}
+
+	BandWriter writer{ options, ofs };
+
+	if (not writer.writeHeader())
+	{
+		return false;
+	}
+
+	const siv::PerlinNoise perlin{ options.seed };
+	const double step = (options.frequency / static_cast<double>(options.width));
+	siv::NoiseThreadPool pool;
+
+	std::vector<Sample> bands[2] =
+	{
+		std::vector<Sample>(options.width * options.bandRows),
+		std::vector<Sample>(options.width * options.bandRows),
+	};
+
+	// At most one write is in flight. It reads one buffer while the next band is generated into the other.
+	std::future<bool> pending;
+	std::size_t band = 0;
+
+	for (std::size_t y = 0; y < options.height; y += options.bandRows, band ^= 1)
+	{
+		const std::size_t rows = std::min(options.bandRows, (options.height - y));
+		siv::PerlinNoise::grid_type grid{ 0.0, 0.0, 0.0, step, step, 1.0, options.width, rows };
+		grid.offsetY = static_cast<std::int64_t>(y);
+
+		Sample* dst = bands[band].data();
+		siv::ParallelFill(pool, dst, grid, [&](Sample* tileDst, const auto& tile) { perlin.fillOctave2D_01(tileDst, tile, options.octaves); });
+
+		if constexpr (sizeof(Sample) == 2)
+		{
+			writer.prepare(dst, (options.width * rows));
+		}
+
+		if (pending.valid() && (not pending.get()))
+		{
+			std::cerr << "Write error\n";
+			return false;
+		}
+
+		pending = std::async(std::launch::async, [&writer, dst, rows] { return writer.writeRows(dst, rows); });
+
+		std::cerr << '\r' << (y + rows) << " / " << options.height << " rows" << std::flush;
+	}
+
+	std::cerr << '\n';
+
+	if (pending.valid() && (not pending.get()))
+	{
+		std::cerr << "Write error\n";
+		return false;
+	}
+
+	return true;
+}
+
+template <class Sample>
+bool ExportNoiseMap(const Options& options)
+{
+	const siv::PerlinNoise perlin{ options.seed };
+	const double step = (options.frequency / static_cast<double>(options.width));
+	const siv::PerlinNoise::grid_type grid{ 0.0, 0.0, 0.0, step, step, 1.0, options.width, options.height };
+
+	if (not siv::WriteNoiseMap<Sample>(options.path, perlin, grid, static_cast<std::uint32_t>(options.bandRows), options.octaves))
+	{
+		std::cerr << "Cannot write " << options.path << '\n';
+		return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 4)
+	{
+		std::cerr << "usage: heightmap output.(bmp|pgm|raw|nmap) width height [frequency] [octaves] [seed] [bits] [bandRows]\n";
+		return 1;
+	}
+
+	Options options;
+	options.path = argv[1];
+	options.width = std::stoull(argv[2]);
+	options.height = std::stoull(argv[3]);
+
+	if (4 < argc) options.frequency = std::stod(argv[4]);
+	if (5 < argc) options.octaves = std::stoi(argv[5]);
+	if (6 < argc) options.seed = static_cast<std::uint32_t>(std::stoul(argv[6]));
+	if (7 < argc) options.bits = std::stoi(argv[7]);
+	if (8 < argc) options.bandRows = std::max<std::size_t>(1, std::stoull(argv[8]));
+
+	const std::string extension = options.path.substr(options.path.find_last_of('.') + 1);
+
+	if (extension == "bmp")
+	{
+		options.format = Format::BMP;
+	}
+	else if (extension == "pgm")
+	{
+		options.format = Format::PGM;
+	}
+	else if (extension == "raw")
+	{
+		options.format = Format::Raw;
+	}
+	else if (extension == "nmap")
+	{
+		options.format = Format::NoiseMap;
+	}
+	else
+	{
+		std::cerr << "Unknown format: " << extension << '\n';
+		return 1;
+	}
+
+	if (((options.bits != 8) && (options.bits != 16)) || ((options.format == Format::BMP) && (options.bits != 8)))
+	{
+		std::cerr << "bits must be 8 or 16 (8 for bmp)\n";
+		return 1;
+	}
+
+	if ((options.width == 0) || (options.height == 0))
+	{
+		std::cerr << "Empty image\n";
+		return 1;
+	}
+
+	if (options.format == Format::NoiseMap)
+	{
+		const bool result = (options.bits == 8) ? ExportNoiseMap<std::uint8_t>(options) : ExportNoiseMap<std::uint16_t>(options);
+		return (result ? 0 : 1);
+	}
+
+	const bool result = (options.bits == 8) ? Export<std::uint8_t>(options) : Export<std::uint16_t>(options);
+
+	return (result ? 0 : 1);
+}